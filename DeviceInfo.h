@@ -12,84 +12,8 @@
 #include <cstdint>
 #include <span>
 
-/// Specifies the Asic type.
-enum GDT_HW_ASIC_TYPE
-{
-    GDT_ASIC_TYPE_NONE = -1,  ///< Undefined asic
-    GDT_TAHITI_PRO     = 0,   ///< TAHITI GPU PRO
-    GDT_TAHITI_XT,            ///< TAHITI GPU XT
-    GDT_PITCAIRN_PRO,         ///< PITCAIRN GPU PRO
-    GDT_PITCAIRN_XT,          ///< PITCAIRN GPU XT
-    GDT_CAPEVERDE_PRO,        ///< CAPE VERDE PRO GPU
-    GDT_CAPEVERDE_XT,         ///< CAPE VERDE XT GPU
-    GDT_OLAND,                ///< OLAND GPU (mobile is MARS)
-    GDT_HAINAN,               ///< HAINAN GPU
-    GDT_BONAIRE,              ///< BONAIRE GPU (mobile is SATURN)
-    GDT_HAWAII,               ///< HAWAII GPU
-    GDT_KALINDI,              ///< KB APU
-    GDT_SPECTRE,              ///< KV APU SPECTRE
-    GDT_SPECTRE_SL,           ///< KV APU SPECTRE SL
-    GDT_SPECTRE_LITE,         ///< KV APU SPECTRE LITE
-    GDT_SPOOKY,               ///< KV APU SPOOKY
-    GDT_ICELAND,              ///< ICELAND GPU
-    GDT_TONGA,                ///< TONGA GPU
-    GDT_CARRIZO,              ///< CZ APU
-    GDT_CARRIZO_EMB,          ///< CZ APU EMBEDDED
-    GDT_FIJI,                 ///< FIJI GPU
-    GDT_STONEY,               ///< STONEY APU
-    GDT_ELLESMERE,            ///< ELLESMERE GPU
-    GDT_BAFFIN,    ///< BAFFIN GPU
-    GDT_GFX8_0_4,  ///< GFX8_0_4 GPU
-    GDT_VEGAM1,    ///< VegaM GPU
-    GDT_VEGAM2,    ///< VegaM GPU
-    GDT_GFX9_0_0,  ///< GFX9_0_0 GPU
-    GDT_GFX9_0_2,  ///< GFX9_0_2 APU
-    GDT_GFX9_0_4,  ///< GFX9_0_4 GPU
-    GDT_GFX9_0_6,  ///< GFX9_0_6 GPU
-    GDT_GFX9_0_9,  ///< GFX9_0_9 GPU
-    GDT_GFX9_0_A,  ///< GFX9_0_A GPU
-    GDT_GFX9_0_C,  ///< GfX9_0_C GPU
-    GDT_GFX9_4_2,  ///< GfX9_4_2 GPU
-    GDT_GFX9_5_0,  ///< Gfx9_5_0 GPU
-    GDT_GFX10_1_0,     ///< GFX10_1_0 GPU
-    GDT_GFX10_1_0_XL,  ///< GFX10_1_0_XL GPU
-    GDT_GFX10_1_2,     ///< GFX10_1_2 GPU
-    GDT_GFX10_1_2_X,   ///< GFX10_1_2 GPU
-    GDT_GFX10_1_2_XT,  ///< GFX10_1_2_XT GPU
-    GDT_GFX10_1_1,     ///< GFX10_1_1 GPU
-    GDT_GFX10_3_0,     ///< GFX10_3_0 GPU
-    GDT_GFX10_3_0_XT,  ///< GFX10_3_0_XT GPU
-    GDT_GFX10_3_0_XTX, ///< GFX10_3_0_XTX GPU
-    GDT_GFX10_3_1,     ///< GFX10_3_1 GPU
-    GDT_GFX10_3_2,     ///< GFX10_3_2 GPU
-    GDT_GFX10_3_2_XT,  ///< GFX10_3_2_XT GPU
-    GDT_GFX10_3_3,     ///< GFX10_3_3 APU
-    GDT_GFX10_3_4,     ///< GFX10_3_4 GPU
-    GDT_GFX10_3_5,     ///< GFX10_3_5 APU
-    GDT_GFX10_3_6,     ///< GFX10_3_6 APU
-    GDT_GFX11_0_0,     ///< GFX11_0_0 GPU
-    GDT_GFX11_0_0_XT,  ///< GFX11_0_0_XT GPU
-    GDT_GFX11_0_0_GRE, ///< GFX11_0_0_GRE GPU
-    GDT_GFX11_0_0_M,   ///< GFX11_0_0_M GPU
-    GDT_GFX11_0_1,     ///< GFX11_0_1 GPU
-    GDT_GFX11_0_1_XT,  ///< GFX11_0_1_XT GPU
-    GDT_GFX11_0_2,     ///< GFX11_0_2 GPU
-    GDT_GFX11_0_2_XT,  ///< GFX11_0_2_XT GPU
-    GDT_GFX11_0_3,     ///< GFX11_0_3 APU
-    GDT_GFX11_0_3A,    ///< GFX11_0_3A APU
-    GDT_GFX11_0_3B,    ///< GFX11_0_3B APU
-    GDT_GFX11_5_0,     ///< GFX11_5_0 APU
-    GDT_GFX11_5_1,     ///< GFX11_5_1 APU
-    GDT_GFX11_5_2,     ///< GFX11_5_2 APU
-    GDT_GFX11_5_3,     ///< GFX11_5_3 APU
-    GDT_GFX11_5_3A,    ///< GFX11_5_3A APU
-    GDT_GFX12_0_0,     ///< GFX12_0_0 GPU
-    GDT_GFX12_0_0_XT,  ///< GFX12_0_0_XT GPU
-    GDT_GFX12_0_1_GRE, ///< GDT_GFX12_0_0_GRE GPU
-    GDT_GFX12_0_1,     ///< GFX12_0_1 GPU
-    GDT_GFX12_0_1_XT,  ///< GFX12_0_1_XT GPU
-    GDT_LAST           ///< Last
-};
+// The GDT_HW_ASIC_TYPE enum and kCardInfoCount, generated from data/asic_types.csv and data/cards.csv.
+#include "DeviceInfoGenerated.h"
 
 /// Specifies the hardware vendor or generation.
 enum GDT_HW_GENERATION
@@ -164,8 +88,27 @@ struct GDT_DeviceInfo
     }
 };
 
+#ifdef DEVICE_INFO_INLINE_TABLES
+
+// The tables are visible to every translation unit, so lookups into them can be constant folded and inlined.
+#include <cassert>
+
+#include "DeviceInfoTable.h"
+
+inline constexpr std::span<const GDT_GfxCardInfo> gs_cardInfo = kCardInfo;
+
+constexpr const GDT_DeviceInfo &GetDeviceInfoForAsicType(const GDT_HW_ASIC_TYPE asic_type)
+{
+    assert(asic_type > GDT_ASIC_TYPE_NONE && asic_type < GDT_LAST);
+    return kDeviceInfo[static_cast<size_t>(asic_type)];
+}
+
+#else
+
 extern const std::span<const GDT_GfxCardInfo> gs_cardInfo;
 
 const GDT_DeviceInfo &GetDeviceInfoForAsicType(const GDT_HW_ASIC_TYPE asic_type);
 
 #endif
+
+#endif
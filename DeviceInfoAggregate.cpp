@@ -0,0 +1,141 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Rollups of the device info of large sets of devices.
+//==============================================================================
+
+#include "DeviceInfoAggregate.h"
+
+#include <algorithm>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "DeviceInfoOverride.h"
+
+namespace
+{
+    constexpr size_t kMinRecordsPerThread = 64 * 1024; ///< Smallest part of a fleet worth counting on a thread of its own.
+} // namespace
+
+void AMDTDeviceInfoUtils::FleetHistogram::Add(std::span<const DeviceRecord> records)
+{
+    // Inventories tend to list the same device many times in a row, so remember the last lookup.
+    DeviceRecord              lastRecord = {};
+    std::optional<CardHandle> lastCard;
+    bool                      hasLast = false;
+
+    for (const DeviceRecord &record : records)
+    {
+        if (!hasLast || record.deviceID != lastRecord.deviceID || record.revisionID != lastRecord.revisionID)
+        {
+            lastRecord = record;
+            lastCard.reset();
+            hasLast = true;
+
+            for (CardHandle card : FindCardsByDeviceId(record.deviceID))
+            {
+                if (kRevisionIdAny == record.revisionID || gs_cardInfo[card].m_revID == record.revisionID)
+                {
+                    lastCard = card;
+                    break;
+                }
+            }
+        }
+
+        if (lastCard.has_value())
+        {
+            ++m_cardCounts[*lastCard];
+        }
+        else
+        {
+            ++m_unresolvedCount;
+        }
+    }
+}
+
+AMDTDeviceInfoUtils::FleetHistogram &AMDTDeviceInfoUtils::FleetHistogram::operator+=(const FleetHistogram &other)
+{
+    for (size_t card = 0; card < m_cardCounts.size(); ++card)
+    {
+        m_cardCounts[card] += other.m_cardCounts[card];
+    }
+    m_unresolvedCount += other.m_unresolvedCount;
+    return *this;
+}
+
+AMDTDeviceInfoUtils::FleetSummary AMDTDeviceInfoUtils::FleetHistogram::Summarize() const
+{
+    FleetSummary summary;
+    summary.unresolvedCount = m_unresolvedCount;
+
+    for (size_t card = 0; card < m_cardCounts.size(); ++card)
+    {
+        const uint64_t count = m_cardCounts[card];
+        if (count == 0)
+        {
+            continue;
+        }
+
+        const GDT_GfxCardInfo &cardInfo = gs_cardInfo[card];
+        const GDT_DeviceInfo  &info     = GetCardDeviceInfo(static_cast<CardHandle>(card));
+
+        summary.deviceCount += count;
+        summary.totalCUs += count * info.numberCUs();
+        summary.totalSIMDs += count * info.numberSIMDs();
+        summary.totalVGPRs += count * info.numberVGPRs();
+        summary.totalLdsBytes += count * GetTotalLdsSizeInBytes(cardInfo.m_generation, info).value_or(0);
+
+        summary.generationCounts[cardInfo.m_generation] += count;
+        if (cardInfo.m_asicType >= 0 && cardInfo.m_asicType < GDT_LAST)
+        {
+            summary.asicTypeCounts[cardInfo.m_asicType] += count;
+        }
+    }
+
+    return summary;
+}
+
+AMDTDeviceInfoUtils::FleetSummary AMDTDeviceInfoUtils::AggregateFleet(std::span<const DeviceRecord> records, unsigned threadCount)
+{
+    if (0 == threadCount)
+    {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    const size_t partCount = std::clamp<size_t>(records.size() / kMinRecordsPerThread, 1, threadCount);
+
+    // Each thread counts a contiguous part into a histogram of its own, and the histograms are merged once the threads finish.
+    std::vector<FleetHistogram> histograms(partCount);
+    std::vector<std::thread>    threads;
+    threads.reserve(partCount - 1);
+
+    for (size_t part = 0; part < partCount; ++part)
+    {
+        const size_t                        begin     = records.size() * part / partCount;
+        const size_t                        end       = records.size() * (part + 1) / partCount;
+        const std::span<const DeviceRecord> partSpan  = records.subspan(begin, end - begin);
+        FleetHistogram                     &histogram = histograms[part];
+
+        if (part + 1 < partCount)
+        {
+            threads.emplace_back([partSpan, &histogram] { histogram.Add(partSpan); });
+        }
+        else
+        {
+            histogram.Add(partSpan);
+        }
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    for (size_t part = 1; part < partCount; ++part)
+    {
+        histograms[0] += histograms[part];
+    }
+
+    return histograms[0].Summarize();
+}
@@ -0,0 +1,72 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Rollups of the device info of large sets of devices.
+//==============================================================================
+
+#ifndef DEVICE_INFO_DEVICE_INFO_AGGREGATE_H_
+#define DEVICE_INFO_DEVICE_INFO_AGGREGATE_H_
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+#include "DeviceInfoQuery.h"
+#include "DeviceInfoUtils.h"
+
+namespace AMDTDeviceInfoUtils
+{
+    /// A device in a fleet, e.g. a row of an inventory.
+    struct DeviceRecord
+    {
+        uint32_t deviceID   = 0;              ///< Device ID.
+        uint32_t revisionID = kRevisionIdAny; ///< Revision ID, kRevisionIdAny if revision ID is not important.
+    };
+
+    /// Totals over a set of devices.
+    struct FleetSummary
+    {
+        uint64_t deviceCount     = 0; ///< Number of devices found in the card info table.
+        uint64_t unresolvedCount = 0; ///< Number of devices not found in the card info table, which are not part of any other total.
+        uint64_t totalCUs        = 0; ///< Total number of compute units.
+        uint64_t totalSIMDs      = 0; ///< Total number of SIMDs.
+        uint64_t totalVGPRs      = 0; ///< Total number of VGPRs.
+        uint64_t totalLdsBytes   = 0; ///< Total LDS size in bytes, of the devices whose generation has a known LDS size.
+
+        std::array<uint64_t, GDT_HW_GENERATION_LAST> generationCounts = {}; ///< Number of devices of each hardware generation.
+        std::array<uint64_t, GDT_LAST>               asicTypeCounts   = {}; ///< Number of devices of each ASIC type.
+    };
+
+    /// Counts the devices of a fleet per card.
+    /// Counting only bumps a counter per device; the device info is looked up once per card when the histogram is summarized. Histograms of
+    /// parts of a fleet can be counted on any thread or executor and merged with operator+=.
+    class FleetHistogram
+    {
+    public:
+        /// Count devices.
+        /// \param[in] records the devices
+        void Add(std::span<const DeviceRecord> records);
+
+        /// Merge the counts of another histogram into this one.
+        /// \param[in] other the histogram to merge
+        /// \return this histogram
+        FleetHistogram &operator+=(const FleetHistogram &other);
+
+        /// Compute the totals of the counted devices, using the device info of each card including any override.
+        /// \return the totals
+        [[nodiscard]] FleetSummary Summarize() const;
+
+    private:
+        std::array<uint64_t, kCardInfoCount> m_cardCounts      = {}; ///< Number of devices per card.
+        uint64_t                             m_unresolvedCount = 0;  ///< Number of devices not found in the card info table.
+    };
+
+    /// Compute the totals over a set of devices, counting parts of the set on parallel threads.
+    /// \param[in] records the devices
+    /// \param[in] threadCount the number of threads to count on, 0 for the number of hardware threads; fewer threads are used for small sets
+    /// \return the totals
+    [[nodiscard]] FleetSummary AggregateFleet(std::span<const DeviceRecord> records, unsigned threadCount = 0);
+} // namespace AMDTDeviceInfoUtils
+
+#endif
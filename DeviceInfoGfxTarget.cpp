@@ -0,0 +1,232 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Parsing, formatting and lookup of gfx target names such as "gfx1151".
+//==============================================================================
+
+#include "DeviceInfoGfxTarget.h"
+
+#include <array>
+
+#include "DeviceInfoGfxIpTable.h"
+#include "DeviceInfoIndex.h"
+#include "DeviceInfoTable.h"
+
+namespace
+{
+    using AMDTDeviceInfoUtils::CardHandle;
+    using namespace AMDTDeviceInfoUtils::Internal;
+
+    consteval size_t CountGfxTargetCards()
+    {
+        size_t count = 0;
+        for (const GDT_GfxCardInfo &card : kCardInfo)
+        {
+            if (AMDTDeviceInfoUtils::ParseGfxTarget(card.m_szCALName).has_value())
+            {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    constexpr size_t kGfxTargetCardCount = CountGfxTargetCards(); ///< Number of cards whose CAL name is a gfx target name.
+
+    consteval std::array<KeyedCard, kGfxTargetCardCount> GfxTargetKeys()
+    {
+        std::array<KeyedCard, kGfxTargetCardCount> entries{};
+        size_t                                     entry = 0;
+        for (size_t i = 0; i < kCardInfoCount; ++i)
+        {
+            if (const auto key = AMDTDeviceInfoUtils::ParseGfxTarget(kCardInfo[i].m_szCALName); key.has_value())
+            {
+                entries[entry++] = {*key, static_cast<CardHandle>(i)};
+            }
+        }
+        return entries;
+    }
+
+    constexpr auto kGfxTargetKeys = GfxTargetKeys(); ///< Cards keyed by the gfx target in their CAL name.
+
+    constexpr auto kGfxTargetIndex = BuildKeyIndex<SlotCountFor(CountDistinctKeys(kGfxTargetKeys))>(kGfxTargetKeys); ///< Gfx target index.
+} // namespace
+
+std::span<const CardHandle> AMDTDeviceInfoUtils::FindCardsByGfxTarget(GfxTargetKey key)
+{
+    return kGfxTargetIndex.Find(key);
+}
+
+namespace
+{
+    using AMDTDeviceInfoUtils::GfxTargetKey;
+    using AMDTDeviceInfoUtils::MakeGfxTargetKey;
+
+    constexpr GfxTargetKey kMatchMajor    = 0xFFFF0000; ///< Rule mask that matches every minor version and stepping of a major version.
+    constexpr GfxTargetKey kMatchMinor    = 0xFFFFFF00; ///< Rule mask that matches every stepping of a minor version.
+    constexpr GfxTargetKey kMatchStepping = 0xFFFFFFFF; ///< Rule mask that matches a single graphics IP version.
+
+    /// Maps the graphics IP versions matching a mask to a hardware generation.
+    struct GfxIpGenerationRule
+    {
+        GfxTargetKey      version;    ///< The first graphics IP version of the generation.
+        GfxTargetKey      mask;       ///< The parts of a graphics IP version that have to match version.
+        GDT_HW_GENERATION generation; ///< The hardware generation.
+    };
+
+    /// The hardware generations of the graphics IP versions. Later, more specific rules override earlier ones.
+    constexpr GfxIpGenerationRule kGfxIpGenerationRules[] = {
+        {MakeGfxTargetKey(6, 0, 0), kMatchMajor, GDT_HW_GENERATION_SOUTHERNISLAND},
+        {MakeGfxTargetKey(7, 0, 0), kMatchMajor, GDT_HW_GENERATION_SEAISLAND},
+        {MakeGfxTargetKey(8, 0, 0), kMatchMajor, GDT_HW_GENERATION_VOLCANICISLAND},
+        {MakeGfxTargetKey(9, 0, 0), kMatchMajor, GDT_HW_GENERATION_GFX9},
+        {MakeGfxTargetKey(9, 0, 8), kMatchStepping, GDT_HW_GENERATION_CDNA},
+        {MakeGfxTargetKey(9, 0, 0xA), kMatchStepping, GDT_HW_GENERATION_CDNA2},
+        {MakeGfxTargetKey(9, 4, 0), kMatchMinor, GDT_HW_GENERATION_CDNA3},
+        {MakeGfxTargetKey(9, 5, 0), kMatchMinor, GDT_HW_GENERATION_CDNA4},
+        {MakeGfxTargetKey(10, 1, 0), kMatchMajor, GDT_HW_GENERATION_GFX10},
+        {MakeGfxTargetKey(10, 3, 0), kMatchMinor, GDT_HW_GENERATION_GFX103},
+        {MakeGfxTargetKey(11, 0, 0), kMatchMajor, GDT_HW_GENERATION_GFX11},
+        {MakeGfxTargetKey(12, 0, 0), kMatchMajor, GDT_HW_GENERATION_GFX12},
+    };
+
+    constexpr uint32_t kMinGfxIpMajor = 6;  ///< Smallest major version in kGfxIpGenerationRules.
+    constexpr uint32_t kMaxGfxIpMajor = 12; ///< Largest major version in kGfxIpGenerationRules.
+
+    constexpr size_t kGfxIpMinorCount    = AMDTDeviceInfoUtils::kMaxGfxTargetMinor + 1;                          ///< Number of minor versions per major version.
+    constexpr size_t kGfxIpSteppingCount = AMDTDeviceInfoUtils::kMaxGfxTargetStepping + 1;                       ///< Number of steppings per minor version.
+    constexpr size_t kGfxIpVersionCount  = (kMaxGfxIpMajor - kMinGfxIpMajor + 1) * kGfxIpMinorCount * kGfxIpSteppingCount; ///< Number of graphics IP versions in the tables.
+
+    /// Get the index of a graphics IP version in the tables.
+    /// \return the index, or kGfxIpVersionCount if the version is outside the tables
+    [[nodiscard]] constexpr size_t GfxIpVersionIndex(GfxTargetKey version)
+    {
+        const uint32_t major    = AMDTDeviceInfoUtils::GfxTargetMajor(version);
+        const uint32_t minor    = AMDTDeviceInfoUtils::GfxTargetMinor(version);
+        const uint32_t stepping = AMDTDeviceInfoUtils::GfxTargetStepping(version);
+        if (major < kMinGfxIpMajor || major > kMaxGfxIpMajor || minor > AMDTDeviceInfoUtils::kMaxGfxTargetMinor ||
+            stepping > AMDTDeviceInfoUtils::kMaxGfxTargetStepping)
+        {
+            return kGfxIpVersionCount;
+        }
+
+        return ((major - kMinGfxIpMajor) * kGfxIpMinorCount + minor) * kGfxIpSteppingCount + stepping;
+    }
+
+    /// Direct-addressed tables between graphics IP versions, hardware generations and ASIC types.
+    struct GfxIpTables
+    {
+        static_assert(GDT_LAST <= UINT8_MAX, "The ASIC type ranges are too narrow for the number of ASIC types.");
+
+        GDT_HW_GENERATION generation[kGfxIpVersionCount]{};              ///< Hardware generation of each graphics IP version.
+        uint8_t           asicBegin[kGfxIpVersionCount]{};               ///< Index of the first ASIC type of each graphics IP version in asicTypes.
+        uint8_t           asicEnd[kGfxIpVersionCount]{};                 ///< One past the index of the last ASIC type of each graphics IP version in asicTypes.
+        GDT_HW_ASIC_TYPE  asicTypes[GDT_LAST]{};                         ///< The ASIC types, grouped by graphics IP version.
+        GfxTargetKey      generationVersion[GDT_HW_GENERATION_LAST]{};   ///< First graphics IP version of each hardware generation, 0 if none.
+
+        consteval GfxIpTables()
+        {
+            for (const GfxIpGenerationRule &rule : kGfxIpGenerationRules)
+            {
+                for (size_t i = 0; i < kGfxIpVersionCount; ++i)
+                {
+                    const GfxTargetKey version = MakeGfxTargetKey(static_cast<uint32_t>(i / (kGfxIpMinorCount * kGfxIpSteppingCount) + kMinGfxIpMajor),
+                                                                  static_cast<uint32_t>((i / kGfxIpSteppingCount) % kGfxIpMinorCount),
+                                                                  static_cast<uint32_t>(i % kGfxIpSteppingCount));
+                    if ((version & rule.mask) == (rule.version & rule.mask))
+                    {
+                        generation[i] = rule.generation;
+                    }
+                }
+
+                if (generationVersion[rule.generation] == 0)
+                {
+                    generationVersion[rule.generation] = rule.version;
+                }
+            }
+
+            // Group the ASIC types by graphics IP version without sorting, keeping them in enum order.
+            for (size_t asic = 0; asic < GDT_LAST; ++asic)
+            {
+                ++asicEnd[GfxIpVersionIndex(kAsicGfxIpVersions[asic])];
+            }
+
+            uint8_t offset = 0;
+            for (size_t i = 0; i < kGfxIpVersionCount; ++i)
+            {
+                const uint8_t count = asicEnd[i];
+                asicBegin[i]        = offset;
+                asicEnd[i]          = offset;
+                offset              = static_cast<uint8_t>(offset + count);
+            }
+
+            for (size_t asic = 0; asic < GDT_LAST; ++asic)
+            {
+                const size_t i          = GfxIpVersionIndex(kAsicGfxIpVersions[asic]);
+                asicTypes[asicEnd[i]++] = static_cast<GDT_HW_ASIC_TYPE>(asic);
+            }
+        }
+    };
+
+    constexpr GfxIpTables kGfxIpTables; ///< The graphics IP version tables.
+
+    /// Check that the graphics IP versions agree with the generation and gfx target of every card.
+    consteval bool GfxIpVersionsMatchCardTable()
+    {
+        for (const GDT_GfxCardInfo &card : kCardInfo)
+        {
+            const GfxTargetKey version = kAsicGfxIpVersions[card.m_asicType];
+            if (kGfxIpTables.generation[GfxIpVersionIndex(version)] != card.m_generation)
+            {
+                return false;
+            }
+
+            const auto target = AMDTDeviceInfoUtils::ParseGfxTarget(card.m_szCALName);
+            if (target.has_value() && *target != version)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    static_assert(GfxIpVersionsMatchCardTable(), "The graphics IP version tables disagree with the card info table.");
+} // namespace
+
+GDT_HW_GENERATION AMDTDeviceInfoUtils::GfxIpVersionToHwGeneration(GfxTargetKey version)
+{
+    const size_t index = GfxIpVersionIndex(version);
+    return (index < kGfxIpVersionCount) ? kGfxIpTables.generation[index] : GDT_HW_GENERATION_NONE;
+}
+
+std::optional<AMDTDeviceInfoUtils::GfxTargetKey> AMDTDeviceInfoUtils::HwGenerationToGfxIpVersion(GDT_HW_GENERATION gen)
+{
+    if (gen < GDT_HW_GENERATION_FIRST_AMD || gen >= GDT_HW_GENERATION_LAST)
+    {
+        return std::nullopt;
+    }
+
+    return kGfxIpTables.generationVersion[gen];
+}
+
+std::optional<AMDTDeviceInfoUtils::GfxTargetKey> AMDTDeviceInfoUtils::AsicTypeToGfxIpVersion(GDT_HW_ASIC_TYPE asicType)
+{
+    if (asicType <= GDT_ASIC_TYPE_NONE || asicType >= GDT_LAST)
+    {
+        return std::nullopt;
+    }
+
+    return kAsicGfxIpVersions[asicType];
+}
+
+std::span<const GDT_HW_ASIC_TYPE> AMDTDeviceInfoUtils::GfxIpVersionToAsicTypes(GfxTargetKey version)
+{
+    const size_t index = GfxIpVersionIndex(version);
+    if (index == kGfxIpVersionCount)
+    {
+        return {};
+    }
+
+    return std::span<const GDT_HW_ASIC_TYPE>(kGfxIpTables.asicTypes).subspan(kGfxIpTables.asicBegin[index], kGfxIpTables.asicEnd[index] - kGfxIpTables.asicBegin[index]);
+}
@@ -0,0 +1,178 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Gfx target names such as "gfx1151" and the mapping between graphics IP versions, generations and ASIC types.
+//==============================================================================
+
+#ifndef DEVICE_INFO_DEVICE_INFO_GFX_TARGET_H_
+#define DEVICE_INFO_DEVICE_INFO_GFX_TARGET_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+
+#include "DeviceInfoQuery.h"
+
+namespace AMDTDeviceInfoUtils
+{
+    /// A gfx target packed into an integer: the major version in bits 16 and up, the minor version in bits 8 to 15 and the stepping in bits 0 to 7.
+    /// Keys compare in the same order as the versions they encode.
+    using GfxTargetKey = uint32_t;
+
+    constexpr uint32_t kMaxGfxTargetMajor    = 99; ///< Largest major version of a gfx target name.
+    constexpr uint32_t kMaxGfxTargetMinor    = 15; ///< Largest minor version of a gfx target name.
+    constexpr uint32_t kMaxGfxTargetStepping = 15; ///< Largest stepping of a gfx target name.
+    constexpr size_t   kMaxGfxTargetLength   = 7;  ///< Length of the longest gfx target name, e.g. "gfx1151".
+
+    /// Pack a gfx target into a key.
+    /// \param major the major version
+    /// \param minor the minor version
+    /// \param stepping the stepping
+    /// \return the key
+    [[nodiscard]] constexpr GfxTargetKey MakeGfxTargetKey(uint32_t major, uint32_t minor, uint32_t stepping)
+    {
+        return (major << 16) | ((minor & 0xFF) << 8) | (stepping & 0xFF);
+    }
+
+    /// Get the major version of a gfx target key.
+    [[nodiscard]] constexpr uint32_t GfxTargetMajor(GfxTargetKey key)
+    {
+        return key >> 16;
+    }
+
+    /// Get the minor version of a gfx target key.
+    [[nodiscard]] constexpr uint32_t GfxTargetMinor(GfxTargetKey key)
+    {
+        return (key >> 8) & 0xFF;
+    }
+
+    /// Get the stepping of a gfx target key.
+    [[nodiscard]] constexpr uint32_t GfxTargetStepping(GfxTargetKey key)
+    {
+        return key & 0xFF;
+    }
+
+    /// Parse a gfx target name such as "gfx1151", "gfx90a" or "gfx1201".
+    /// The name is "gfx" followed by the major version in decimal and then the minor version and the stepping as one
+    /// lower case hexadecimal digit each. Only the canonical spelling written by FormatGfxTarget is accepted, so two names
+    /// parse to the same key exactly if they are equal.
+    /// \param[in] target the gfx target name, which does not need to be NUL terminated
+    /// \return the key of the gfx target, or std::nullopt if the name is not a gfx target name
+    [[nodiscard]] constexpr std::optional<GfxTargetKey> ParseGfxTarget(std::string_view target)
+    {
+        constexpr std::string_view kPrefix = "gfx";
+
+        // At least one major version digit, followed by the minor version and stepping digits.
+        if (target.size() < kPrefix.size() + 3 || target.size() > kMaxGfxTargetLength || !target.starts_with(kPrefix))
+        {
+            return std::nullopt;
+        }
+
+        auto hex_digit = [](char c) -> std::optional<uint32_t>
+        {
+            if (c >= '0' && c <= '9')
+            {
+                return static_cast<uint32_t>(c - '0');
+            }
+            if (c >= 'a' && c <= 'f')
+            {
+                return static_cast<uint32_t>(c - 'a' + 10);
+            }
+            return std::nullopt;
+        };
+
+        const std::string_view majorDigits = target.substr(kPrefix.size(), target.size() - kPrefix.size() - 2);
+        if (majorDigits.front() == '0')
+        {
+            return std::nullopt;
+        }
+
+        uint32_t major = 0;
+        for (char c : majorDigits)
+        {
+            if (c < '0' || c > '9')
+            {
+                return std::nullopt;
+            }
+            major = major * 10 + static_cast<uint32_t>(c - '0');
+        }
+
+        const std::optional<uint32_t> minor    = hex_digit(target[target.size() - 2]);
+        const std::optional<uint32_t> stepping = hex_digit(target[target.size() - 1]);
+        if (!minor.has_value() || !stepping.has_value())
+        {
+            return std::nullopt;
+        }
+
+        return MakeGfxTargetKey(major, *minor, *stepping);
+    }
+
+    /// Format a gfx target key as a gfx target name, e.g. "gfx1151".
+    /// \param[in] key the key to format
+    /// \param[out] buffer the buffer to write the name to; kMaxGfxTargetLength characters are always enough
+    /// \return the name, which is a view into buffer; empty if the key is out of range or the buffer is too small
+    [[nodiscard]] constexpr std::string_view FormatGfxTarget(GfxTargetKey key, std::span<char> buffer)
+    {
+        constexpr char kDigits[] = "0123456789abcdef";
+
+        const uint32_t major    = GfxTargetMajor(key);
+        const uint32_t minor    = GfxTargetMinor(key);
+        const uint32_t stepping = GfxTargetStepping(key);
+        if (major == 0 || major > kMaxGfxTargetMajor || minor > kMaxGfxTargetMinor || stepping > kMaxGfxTargetStepping)
+        {
+            return {};
+        }
+
+        const size_t length = (major < 10) ? 6 : 7;
+        if (buffer.size() < length)
+        {
+            return {};
+        }
+
+        size_t pos    = 0;
+        buffer[pos++] = 'g';
+        buffer[pos++] = 'f';
+        buffer[pos++] = 'x';
+        if (major >= 10)
+        {
+            buffer[pos++] = kDigits[major / 10];
+        }
+        buffer[pos++] = kDigits[major % 10];
+        buffer[pos++] = kDigits[minor];
+        buffer[pos++] = kDigits[stepping];
+
+        return std::string_view(buffer.data(), length);
+    }
+
+    /// Find the cards whose CAL name is a gfx target name with the specified key.
+    /// \param[in] key the key of the gfx target
+    /// \return the matching cards in table order, empty if there are none
+    [[nodiscard]] std::span<const CardHandle> FindCardsByGfxTarget(GfxTargetKey key);
+
+    /// Get the hardware generation of a full graphics IP version.
+    /// Versions are matched as specifically as known, so 10.3.x maps to GDT_HW_GENERATION_GFX103, 9.0.a to GDT_HW_GENERATION_CDNA2
+    /// and 9.4.x to GDT_HW_GENERATION_CDNA3, while other versions map to the generation of their major version.
+    /// \param[in] version the graphics IP version, as packed by MakeGfxTargetKey
+    /// \return the hardware generation, GDT_HW_GENERATION_NONE if the version does not belong to a known generation
+    [[nodiscard]] GDT_HW_GENERATION GfxIpVersionToHwGeneration(GfxTargetKey version);
+
+    /// Get the first graphics IP version of a hardware generation, e.g. 10.3.0 for GDT_HW_GENERATION_GFX103.
+    /// \param[in] gen the hardware generation
+    /// \return the graphics IP version, or std::nullopt if gen is not an AMD hardware generation
+    [[nodiscard]] std::optional<GfxTargetKey> HwGenerationToGfxIpVersion(GDT_HW_GENERATION gen);
+
+    /// Get the full graphics IP version of an ASIC type, e.g. 9.4.2 for GDT_GFX9_4_2 and 6.0.0 for GDT_TAHITI_XT.
+    /// \param[in] asicType the ASIC type
+    /// \return the graphics IP version, or std::nullopt if asicType is not a valid ASIC type
+    [[nodiscard]] std::optional<GfxTargetKey> AsicTypeToGfxIpVersion(GDT_HW_ASIC_TYPE asicType);
+
+    /// Get the ASIC types with a full graphics IP version.
+    /// \param[in] version the graphics IP version, as packed by MakeGfxTargetKey
+    /// \return the ASIC types in enum order, empty if there are none
+    [[nodiscard]] std::span<const GDT_HW_ASIC_TYPE> GfxIpVersionToAsicTypes(GfxTargetKey version);
+} // namespace AMDTDeviceInfoUtils
+
+#endif
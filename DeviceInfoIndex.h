@@ -0,0 +1,192 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Compile-time building blocks for the lookup indexes over the card table.
+//==============================================================================
+
+#ifndef DEVICE_INFO_DEVICE_INFO_INDEX_H_
+#define DEVICE_INFO_DEVICE_INFO_INDEX_H_
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+#include "DeviceInfoQuery.h"
+
+namespace AMDTDeviceInfoUtils::Internal
+{
+    /// Hash a string with 64-bit FNV-1a.
+    /// \param str the string to hash
+    /// \return the hash of the string
+    [[nodiscard]] constexpr uint64_t HashString(std::string_view str)
+    {
+        uint64_t hash = 0xCBF29CE484222325;
+        for (char c : str)
+        {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 0x100000001B3;
+        }
+        return hash;
+    }
+
+    /// A value, such as a card, together with the key it is indexed under.
+    template <typename Value>
+    struct KeyedValue
+    {
+        uint64_t key;   ///< The key.
+        Value    value; ///< The value.
+    };
+
+    /// A card together with the key it is indexed under.
+    using KeyedCard = KeyedValue<CardHandle>;
+
+    /// Get the slot to start probing at for a key in a hash table with 2^slotBits slots.
+    [[nodiscard]] constexpr size_t HomeSlot(uint64_t key, int slotBits)
+    {
+        return (slotBits == 0) ? 0 : static_cast<size_t>((key * 0x9E3779B97F4A7C15) >> (64 - slotBits));
+    }
+
+    /// Get the slot to start probing at for a key in a hash table with the specified number of slots.
+    template <size_t kSlotCount>
+    [[nodiscard]] constexpr size_t HomeSlot(uint64_t key)
+    {
+        static_assert(std::has_single_bit(kSlotCount), "The slot count needs to be a power of two.");
+
+        return HomeSlot(key, std::countr_zero(kSlotCount));
+    }
+
+    /// Count the distinct keys of keyed values.
+    /// \param entries the keyed values
+    /// \return the number of distinct keys
+    template <typename Value, size_t kEntryCount>
+    [[nodiscard]] consteval size_t CountDistinctKeys(const std::array<KeyedValue<Value>, kEntryCount> &entries)
+    {
+        constexpr size_t kSlotCount = std::bit_ceil(2 * kEntryCount);
+
+        // Plain arrays and pointers keep this cheap to evaluate for large inputs.
+        struct Slot
+        {
+            uint64_t key  = 0;
+            bool     used = false;
+        };
+
+        Slot                     slots[kSlotCount]{};
+        const KeyedValue<Value> *entry = entries.data();
+        size_t                   count = 0;
+
+        for (size_t i = 0; i < kEntryCount; ++i)
+        {
+            size_t slot = HomeSlot<kSlotCount>(entry[i].key);
+            while (slots[slot].used && slots[slot].key != entry[i].key)
+            {
+                slot = (slot + 1) & (kSlotCount - 1);
+            }
+            if (!slots[slot].used)
+            {
+                slots[slot] = {entry[i].key, true};
+                ++count;
+            }
+        }
+
+        return count;
+    }
+
+    /// Get the hash table size that keeps the load factor of an index at or below one half.
+    /// \param keyCount the number of distinct keys in the index
+    /// \return the number of hash table slots
+    [[nodiscard]] constexpr size_t SlotCountFor(size_t keyCount)
+    {
+        return std::bit_ceil(std::max<size_t>(2 * keyCount, 2));
+    }
+
+    /// Open-addressing hash table from a key to the range of values indexed under that key.
+    template <typename Value, size_t kEntryCount, size_t kSlotCount>
+    struct KeyIndex
+    {
+        static_assert(std::has_single_bit(kSlotCount), "The slot count needs to be a power of two.");
+
+        /// A hash table slot. Slots with an empty range are unused.
+        struct Slot
+        {
+            uint64_t key   = 0; ///< The key.
+            uint32_t begin = 0; ///< Index of the first value with the key in values.
+            uint32_t end   = 0; ///< One past the index of the last value with the key in values.
+        };
+
+        std::array<Value, kEntryCount> values{}; ///< The indexed values, grouped by key.
+        std::array<Slot, kSlotCount>   slots{};  ///< The hash table.
+
+        /// Find the values indexed under a key.
+        /// \param key the key to look up
+        /// \return the values in the order they were indexed in, empty if the key is not indexed
+        [[nodiscard]] constexpr std::span<const Value> Find(uint64_t key) const
+        {
+            for (size_t slot = HomeSlot<kSlotCount>(key);; slot = (slot + 1) & (kSlotCount - 1))
+            {
+                const Slot &candidate = slots[slot];
+                if (candidate.begin == candidate.end)
+                {
+                    return {};
+                }
+                if (candidate.key == key)
+                {
+                    return std::span<const Value>(values).subspan(candidate.begin, candidate.end - candidate.begin);
+                }
+            }
+        }
+    };
+
+    /// Build an index from keyed values.
+    /// \param entries the keyed values, in the order the values of each key are to be found in, e.g. table order for cards
+    /// \return the index
+    template <size_t kSlotCount, typename Value, size_t kEntryCount>
+    [[nodiscard]] consteval KeyIndex<Value, kEntryCount, kSlotCount> BuildKeyIndex(const std::array<KeyedValue<Value>, kEntryCount> &entries)
+    {
+        using Slot = typename KeyIndex<Value, kEntryCount, kSlotCount>::Slot;
+
+        // Plain arrays and pointers keep this cheap to evaluate for large inputs.
+        KeyIndex<Value, kEntryCount, kSlotCount> index;
+        Slot                                    *slots  = index.slots.data();
+        Value                                   *values = index.values.data();
+        const KeyedValue<Value>                 *entry  = entries.data();
+        size_t                                   entrySlots[kEntryCount]{};
+
+        // Count the values of each key, then lay the keys out in slot order and place the values without sorting.
+        for (size_t i = 0; i < kEntryCount; ++i)
+        {
+            size_t slot = HomeSlot<kSlotCount>(entry[i].key);
+            while (slots[slot].end != 0 && slots[slot].key != entry[i].key)
+            {
+                slot = (slot + 1) & (kSlotCount - 1);
+            }
+            slots[slot].key = entry[i].key;
+            ++slots[slot].end;
+            entrySlots[i] = slot;
+        }
+
+        uint32_t next[kSlotCount]{};
+        uint32_t offset = 0;
+        for (size_t slot = 0; slot < kSlotCount; ++slot)
+        {
+            const uint32_t count = slots[slot].end;
+            slots[slot].begin    = offset;
+            slots[slot].end      = offset + count;
+            next[slot]           = offset;
+            offset += count;
+        }
+
+        for (size_t i = 0; i < kEntryCount; ++i)
+        {
+            values[next[entrySlots[i]]++] = entry[i].value;
+        }
+
+        return index;
+    }
+} // namespace AMDTDeviceInfoUtils::Internal
+
+#endif
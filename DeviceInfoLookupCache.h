@@ -0,0 +1,124 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Per-thread caches of the most recent lookups.
+//==============================================================================
+
+#ifndef DEVICE_INFO_DEVICE_INFO_LOOKUP_CACHE_H_
+#define DEVICE_INFO_DEVICE_INFO_LOOKUP_CACHE_H_
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace AMDTDeviceInfoUtils::Internal
+{
+    /// Changes whenever a lookup result may change, i.e. when a translator, the overrides or the vendor backends change.
+    /// Starts at 1 so the zero-initialized caches of new threads are stale.
+    inline std::atomic<uint64_t> gs_lookupEpoch = 1;
+
+    /// Invalidate the lookup caches of every thread.
+    /// Call this after publishing the state that changes lookup results, so a lookup that sees the new epoch also sees the new state.
+    inline void InvalidateLookupCaches()
+    {
+        gs_lookupEpoch.fetch_add(1, std::memory_order_release);
+    }
+
+    /// The key of a device lookup.
+    struct DeviceLookupKey
+    {
+        uint32_t vendorID;   ///< PCI vendor ID.
+        uint32_t deviceID;   ///< Device ID.
+        uint32_t revisionID; ///< Revision ID.
+
+        friend constexpr bool operator==(const DeviceLookupKey &, const DeviceLookupKey &) = default;
+    };
+
+    /// The key of a device name lookup: a short name stored inline. Longer names are not cached.
+    struct NameLookupKey
+    {
+        static constexpr size_t kMaxLength = 15; ///< Length of the longest name that can be cached.
+
+        std::array<char, kMaxLength> name;   ///< The name, padded with zeros.
+        uint8_t                      length; ///< Length of the name.
+
+        /// Make the key of a name.
+        /// \return the key, or std::nullopt if the name is too long to be cached
+        [[nodiscard]] static constexpr std::optional<NameLookupKey> Make(std::string_view name)
+        {
+            if (name.size() > kMaxLength)
+            {
+                return std::nullopt;
+            }
+
+            NameLookupKey key{};
+            std::ranges::copy(name, key.name.begin());
+            key.length = static_cast<uint8_t>(name.size());
+            return key;
+        }
+
+        friend constexpr bool operator==(const NameLookupKey &, const NameLookupKey &) = default;
+    };
+
+    /// The last few results of a lookup on one thread, meant for thread_local storage.
+    /// A hit is a comparison against the cached keys and a load of gs_lookupEpoch, which is only written when lookup results change.
+    /// Without DEVICE_INFO_LOOKUP_CACHE every lookup goes straight to the index.
+    template <typename Key, typename Value, size_t kEntryCount = 4>
+    class LookupCache
+    {
+    public:
+        /// Get the result of a lookup, from the cache if the key was looked up recently.
+        /// \param key the key
+        /// \param lookup called to look the key up on a miss
+        /// \return the result of the lookup
+        template <typename Lookup>
+        [[nodiscard]] Value Get(const Key &key, Lookup &&lookup)
+        {
+#ifdef DEVICE_INFO_LOOKUP_CACHE
+            const uint64_t epoch = gs_lookupEpoch.load(std::memory_order_acquire);
+            if (epoch != m_epoch)
+            {
+                m_epoch = epoch;
+                m_count = 0;
+            }
+
+            for (size_t i = 0; i < m_count; ++i)
+            {
+                if (m_entries[i].key == key)
+                {
+                    return m_entries[i].value;
+                }
+            }
+
+            const Value value = lookup();
+            m_entries[m_next] = {key, value};
+            m_next            = (m_next + 1) % kEntryCount;
+            m_count           = std::min(m_count + 1, kEntryCount);
+            return value;
+#else
+            static_cast<void>(key);
+            return lookup();
+#endif
+        }
+
+    private:
+        /// A cached lookup result.
+        struct Entry
+        {
+            Key   key;   ///< The key.
+            Value value; ///< The result.
+        };
+
+        std::array<Entry, kEntryCount> m_entries = {}; ///< The cached results.
+        uint64_t                       m_epoch   = 0;  ///< Value of gs_lookupEpoch when the results were cached.
+        size_t                         m_count   = 0;  ///< Number of valid entries.
+        size_t                         m_next    = 0;  ///< Entry to replace next.
+    };
+} // namespace AMDTDeviceInfoUtils::Internal
+
+#endif
@@ -0,0 +1,44 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Hooks that record the lookups that found no device.
+//==============================================================================
+
+#ifndef DEVICE_INFO_DEVICE_INFO_MISS_RECORDER_H_
+#define DEVICE_INFO_DEVICE_INFO_MISS_RECORDER_H_
+
+#include <atomic>
+#include <cstdint>
+#include <string_view>
+
+#include "DeviceInfoMisses.h"
+
+namespace AMDTDeviceInfoUtils::Internal
+{
+    /// Whether misses are being recorded.
+    inline std::atomic<bool> gs_lookupMissRecording = false;
+
+    /// Append a miss to the miss buffer, or count it as dropped if the buffer is full.
+    void PushLookupMiss(LookupTraceApi api, uint32_t vendorID, uint32_t deviceID, uint32_t revisionID, std::string_view name);
+
+    /// Record a lookup by device ID that found no device, if misses are being recorded.
+    inline void RecordLookupMiss(LookupTraceApi api, uint32_t vendorID, uint32_t deviceID, uint32_t revisionID)
+    {
+        if (gs_lookupMissRecording.load(std::memory_order_relaxed))
+        {
+            PushLookupMiss(api, vendorID, deviceID, revisionID, {});
+        }
+    }
+
+    /// Record a lookup by name that found no device, if misses are being recorded.
+    inline void RecordLookupMiss(LookupTraceApi api, std::string_view name)
+    {
+        if (gs_lookupMissRecording.load(std::memory_order_relaxed))
+        {
+            PushLookupMiss(api, 0, 0, 0, name);
+        }
+    }
+} // namespace AMDTDeviceInfoUtils::Internal
+
+#endif
@@ -0,0 +1,141 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Recording of the lookups that found no device, e.g. of new SKUs missing from the tables.
+//==============================================================================
+
+#include "DeviceInfoMisses.h"
+
+#include <algorithm>
+#include <bit>
+#include <mutex>
+
+#include "DeviceInfoMissRecorder.h"
+
+namespace
+{
+    using AMDTDeviceInfoUtils::LookupMiss;
+
+    static_assert(std::has_single_bit(AMDTDeviceInfoUtils::kLookupMissCapacity), "The miss buffer capacity needs to be a power of two.");
+
+    /// A bounded multi-producer single-consumer queue of misses.
+    /// Every cell has a sequence number that tells whose turn it is: a producer may fill the cell at position pos when the sequence
+    /// is pos, and the consumer may take it when the sequence is pos + 1. Producers claim positions with a compare-and-swap and
+    /// never wait; a producer that finds its cell not yet taken knows the queue is full.
+    class MissQueue
+    {
+    public:
+        /// Append a miss, unless the queue is full.
+        /// \return false if the queue is full
+        bool Push(const LookupMiss &miss)
+        {
+            size_t pos = m_pushPos.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                Cell           &cell = m_cells[pos & kMask];
+                const ptrdiff_t turn = static_cast<ptrdiff_t>(Sequence(cell, pos) - pos);
+                if (turn == 0)
+                {
+                    if (m_pushPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        cell.miss = miss;
+                        SetSequence(cell, pos, pos + 1);
+                        return true;
+                    }
+                }
+                else if (turn < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    pos = m_pushPos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /// Take the oldest misses. Only one thread may call this at a time.
+        /// \return the number of misses written to misses
+        size_t Drain(std::span<LookupMiss> misses)
+        {
+            size_t count = 0;
+            while (count < misses.size())
+            {
+                Cell &cell = m_cells[m_popPos & kMask];
+                if (Sequence(cell, m_popPos) != m_popPos + 1)
+                {
+                    break;
+                }
+
+                misses[count++] = cell.miss;
+                SetSequence(cell, m_popPos, m_popPos + AMDTDeviceInfoUtils::kLookupMissCapacity);
+                ++m_popPos;
+            }
+            return count;
+        }
+
+    private:
+        static constexpr size_t kMask = AMDTDeviceInfoUtils::kLookupMissCapacity - 1; ///< Mask of the cell index of a position.
+
+        /// A cell of the queue.
+        struct Cell
+        {
+            std::atomic<size_t> sequence = 0; ///< The sequence number minus the index of the cell, so zero-initialized cells are ready.
+            LookupMiss          miss;         ///< The miss.
+        };
+
+        /// Get the sequence number of the cell at a position.
+        static size_t Sequence(const Cell &cell, size_t pos)
+        {
+            return cell.sequence.load(std::memory_order_acquire) + (pos & kMask);
+        }
+
+        /// Set the sequence number of the cell at a position, publishing or releasing its miss.
+        static void SetSequence(Cell &cell, size_t pos, size_t sequence)
+        {
+            cell.sequence.store(sequence - (pos & kMask), std::memory_order_release);
+        }
+
+        std::array<Cell, AMDTDeviceInfoUtils::kLookupMissCapacity> m_cells;       ///< The cells.
+        alignas(64) std::atomic<size_t>                            m_pushPos = 0; ///< Position of the next miss to append.
+        alignas(64) size_t                                         m_popPos  = 0; ///< Position of the next miss to take.
+    };
+
+    constinit MissQueue             gs_missQueue;            ///< The recorded misses.
+    constinit std::atomic<uint64_t> gs_droppedMissCount = 0; ///< Number of misses dropped because gs_missQueue was full.
+    std::mutex                      gs_missDrainMutex;       ///< Serializes the consumers of gs_missQueue.
+} // namespace
+
+void AMDTDeviceInfoUtils::Internal::PushLookupMiss(LookupTraceApi api, uint32_t vendorID, uint32_t deviceID, uint32_t revisionID, std::string_view name)
+{
+    LookupMiss miss;
+    miss.time       = std::chrono::system_clock::now();
+    miss.api        = api;
+    miss.vendorID   = vendorID;
+    miss.deviceID   = deviceID;
+    miss.revisionID = revisionID;
+    miss.nameLength = static_cast<uint8_t>(std::min(name.size(), kMaxLookupMissNameLength));
+    std::copy_n(name.data(), miss.nameLength, miss.name.data());
+
+    if (!gs_missQueue.Push(miss))
+    {
+        gs_droppedMissCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void AMDTDeviceInfoUtils::SetLookupMissRecording(bool enable)
+{
+    Internal::gs_lookupMissRecording.store(enable, std::memory_order_relaxed);
+}
+
+size_t AMDTDeviceInfoUtils::DrainLookupMisses(std::span<LookupMiss> misses)
+{
+    std::lock_guard<std::mutex> lock(gs_missDrainMutex);
+    return gs_missQueue.Drain(misses);
+}
+
+uint64_t AMDTDeviceInfoUtils::TakeDroppedLookupMissCount()
+{
+    return gs_droppedMissCount.exchange(0, std::memory_order_relaxed);
+}
@@ -0,0 +1,64 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Recording of the lookups that found no device, e.g. of new SKUs missing from the tables.
+//==============================================================================
+
+#ifndef DEVICE_INFO_DEVICE_INFO_MISSES_H_
+#define DEVICE_INFO_DEVICE_INFO_MISSES_H_
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+#include "DeviceInfoTrace.h"
+
+namespace AMDTDeviceInfoUtils
+{
+    inline constexpr size_t kLookupMissCapacity      = 1024; ///< Number of misses that can be recorded before the misses are drained.
+    inline constexpr size_t kMaxLookupMissNameLength = 47;   ///< Names of missed name lookups are truncated to this many characters.
+
+    /// A lookup that found no device.
+    struct LookupMiss
+    {
+        std::chrono::system_clock::time_point      time;                                   ///< When the lookup was made.
+        LookupTraceApi                             api        = LookupTraceApi::kDeviceId; ///< The lookup API.
+        uint32_t                                   vendorID   = 0;                         ///< PCI vendor ID, for device ID lookups.
+        uint32_t                                   deviceID   = 0;                         ///< Device ID, for device ID lookups.
+        uint32_t                                   revisionID = 0;                         ///< Revision ID, for device ID lookups.
+        uint8_t                                    nameLength = 0;                         ///< Length of name.
+        std::array<char, kMaxLookupMissNameLength> name       = {};                        ///< The name, for name lookups; truncated, not NUL terminated.
+
+        /// Get the name of a missed name lookup.
+        [[nodiscard]] std::string_view Name() const
+        {
+            return std::string_view(name.data(), nameLength);
+        }
+    };
+
+    /// Start or stop recording the lookups that find no device.
+    /// Misses are recorded into a fixed-size lock-free ring buffer: recording never blocks or allocates, and when the buffer is
+    /// full the miss is dropped and counted instead. Lookups that find a device are not affected; with recording stopped, a miss
+    /// costs one more atomic load. A miss is recorded once, with its API and key, by every lookup StartLookupTrace records, whichever
+    /// overload made it, including the ones that fill a std::vector; GetDeviceInfoMarketingName also records a name that only
+    /// matches after normalization.
+    /// \param[in] enable true to start recording, false to stop
+    void SetLookupMissRecording(bool enable);
+
+    /// Take the oldest recorded misses out of the buffer.
+    /// Drains are serialized with each other, but never block lookups. A miss that is still being recorded by another thread
+    /// ends the drain early; it is returned by the next drain.
+    /// \param[out] misses the buffer to move the misses to
+    /// \return the number of misses written to misses
+    size_t DrainLookupMisses(std::span<LookupMiss> misses);
+
+    /// Get the number of misses dropped because the buffer was full, and reset it.
+    /// \return the number of misses dropped since the last call
+    uint64_t TakeDroppedLookupMissCount();
+} // namespace AMDTDeviceInfoUtils
+
+#endif
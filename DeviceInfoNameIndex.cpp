@@ -0,0 +1,695 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Precomputed name indexes over the card table.
+//==============================================================================
+
+#include "DeviceInfoNameIndex.h"
+
+#include <algorithm>
+#include <array>
+#include <utility>
+
+#include "DeviceInfoIndex.h"
+#include "DeviceInfoMissRecorder.h"
+#include "DeviceInfoNameLookup.h"
+#include "DeviceInfoTable.h"
+#include "DeviceInfoTraceRecorder.h"
+
+namespace
+{
+    using AMDTDeviceInfoUtils::CardHandle;
+    using AMDTDeviceInfoUtils::kMaxNormalizedNameLength;
+    using namespace AMDTDeviceInfoUtils::Internal;
+
+    // The helpers below work on plain arrays and pointers rather than std::string_view and std::array,
+    // since they run over the whole card table during constant evaluation and compilers evaluate them much faster that way.
+
+    /// Convert an ASCII character to lower case.
+    [[nodiscard]] constexpr char FoldCase(char c)
+    {
+        return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+    }
+
+    /// Compare a token to a lower case word, ignoring the case of the token.
+    [[nodiscard]] constexpr bool IsWord(const char *token, size_t tokenLength, const char *word, size_t wordLength)
+    {
+        if (tokenLength != wordLength)
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < tokenLength; ++i)
+        {
+            if (FoldCase(token[i]) != word[i])
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /// Get the length of the separator at the start of a name.
+    /// \return the number of characters to skip, 0 if the name does not start with a separator
+    [[nodiscard]] constexpr size_t SeparatorLength(const char *name, size_t size)
+    {
+        switch (name[0])
+        {
+            case ' ':
+            case '\t':
+            case '\r':
+            case '\n':
+            case '(':
+            case ')':
+                return 1;
+
+            case '\xE2': // UTF-8 trade mark sign
+                return (size >= 3 && name[1] == '\x84' && name[2] == '\xA2') ? 3 : 0;
+
+            case '\xC2': // UTF-8 registered sign
+                return (size >= 2 && name[1] == '\xAE') ? 2 : 0;
+
+            default:
+                return 0;
+        }
+    }
+
+    /// Normalize a marketing name, see AMDTDeviceInfoUtils::NormalizeMarketingName.
+    /// \return the length of the normalized name
+    [[nodiscard]] constexpr size_t NormalizeName(const char *name, size_t size, char *buffer, size_t bufferSize)
+    {
+        size_t length = 0;
+        size_t pos    = 0;
+
+        while (pos < size)
+        {
+            if (const size_t separatorLength = SeparatorLength(name + pos, size - pos); separatorLength != 0)
+            {
+                pos += separatorLength;
+                continue;
+            }
+
+            const size_t tokenStart = pos;
+            while (++pos < size && SeparatorLength(name + pos, size - pos) == 0)
+            {
+            }
+
+            const char *token       = name + tokenStart;
+            size_t      tokenLength = pos - tokenStart;
+
+            if (IsWord(token, tokenLength, "tm", 2) || IsWord(token, tokenLength, "r", 1))
+            {
+                continue;
+            }
+
+            if (IsWord(token, tokenLength, "graphic", 7))
+            {
+                token       = "graphics";
+                tokenLength = 8;
+            }
+
+            for (size_t i = 0; i < tokenLength; ++i)
+            {
+                if (length == bufferSize)
+                {
+                    return length;
+                }
+                buffer[length++] = FoldCase(token[i]);
+            }
+        }
+
+        return length;
+    }
+
+    /// Normalize the beginning of a marketing name.
+    /// Unlike in a complete name, a trailing "R" or "TM" is kept, since it may be the beginning of a longer word such as "RX".
+    /// \return the length of the normalized prefix
+    [[nodiscard]] size_t NormalizePrefix(const char *prefix, size_t size, char *buffer, size_t bufferSize)
+    {
+        size_t length = NormalizeName(prefix, size, buffer, bufferSize);
+
+        // Find the last token, unless the prefix ends with a separator.
+        size_t tokenStart  = 0;
+        size_t tokenLength = 0;
+        for (size_t pos = 0; pos < size;)
+        {
+            if (const size_t separatorLength = SeparatorLength(prefix + pos, size - pos); separatorLength != 0)
+            {
+                pos += separatorLength;
+                tokenLength = 0;
+                continue;
+            }
+
+            tokenStart = pos;
+            while (++pos < size && SeparatorLength(prefix + pos, size - pos) == 0)
+            {
+            }
+            tokenLength = pos - tokenStart;
+        }
+
+        if (IsWord(prefix + tokenStart, tokenLength, "tm", 2) || IsWord(prefix + tokenStart, tokenLength, "r", 1))
+        {
+            for (size_t i = 0; i < tokenLength && length < bufferSize; ++i)
+            {
+                buffer[length++] = FoldCase(prefix[tokenStart + i]);
+            }
+        }
+
+        return length;
+    }
+
+    /// A normalized name in a fixed-size buffer, so names can be normalized during constant evaluation.
+    struct NormalizedName
+    {
+        char   buffer[kMaxNormalizedNameLength]{}; ///< Storage for the name.
+        size_t length = 0;                         ///< Length of the name.
+
+        constexpr explicit NormalizedName(std::string_view name)
+            : length(NormalizeName(name.data(), name.size(), buffer, kMaxNormalizedNameLength))
+        {
+        }
+
+        [[nodiscard]] constexpr std::string_view View() const
+        {
+            return std::string_view(buffer, length);
+        }
+    };
+
+    consteval std::array<KeyedCard, kCardInfoCount> MarketingNameKeys()
+    {
+        std::array<KeyedCard, kCardInfoCount> entries{};
+        for (size_t i = 0; i < kCardInfoCount; ++i)
+        {
+            entries[i] = {HashString(NormalizedName(kCardInfo[i].m_szMarketingName).View()), static_cast<CardHandle>(i)};
+        }
+
+        return entries;
+    }
+
+    constexpr auto kMarketingNameKeys = MarketingNameKeys(); ///< Cards keyed by the hash of their normalized marketing name.
+
+    constexpr auto kMarketingNameIndex = BuildKeyIndex<SlotCountFor(CountDistinctKeys(kMarketingNameKeys))>(kMarketingNameKeys); ///< Normalized marketing name index.
+
+    consteval std::array<KeyedCard, kCardInfoCount> CalNameKeys()
+    {
+        std::array<KeyedCard, kCardInfoCount> entries{};
+        for (size_t i = 0; i < kCardInfoCount; ++i)
+        {
+            entries[i] = {HashString(kCardInfo[i].m_szCALName), static_cast<CardHandle>(i)};
+        }
+
+        return entries;
+    }
+
+    constexpr auto kCalNameKeys = CalNameKeys(); ///< Cards keyed by the hash of their CAL name.
+
+    constexpr auto kCalNameIndex = BuildKeyIndex<SlotCountFor(CountDistinctKeys(kCalNameKeys))>(kCalNameKeys); ///< CAL name index.
+
+    /// Compare two normalized names byte by byte.
+    /// \return a negative value, zero or a positive value if lhs sorts before, equal to or after rhs
+    [[nodiscard]] constexpr int CompareNames(const char *lhs, size_t lhsLength, const char *rhs, size_t rhsLength)
+    {
+        const size_t length = std::min(lhsLength, rhsLength);
+        for (size_t i = 0; i < length; ++i)
+        {
+            if (lhs[i] != rhs[i])
+            {
+                return static_cast<unsigned char>(lhs[i]) < static_cast<unsigned char>(rhs[i]) ? -1 : 1;
+            }
+        }
+
+        return (lhsLength < rhsLength) ? -1 : ((lhsLength > rhsLength) ? 1 : 0);
+    }
+
+    consteval size_t NormalizedMarketingNamesLength()
+    {
+        size_t length = 0;
+        for (const GDT_GfxCardInfo &card : kCardInfo)
+        {
+            length += NormalizedName(card.m_szMarketingName).length;
+        }
+        return length;
+    }
+
+    constexpr size_t kNormalizedMarketingNamesLength = NormalizedMarketingNamesLength(); ///< Total length of the normalized marketing names of all cards.
+
+    /// The normalized marketing names of all cards and the cards in order of their normalized marketing name.
+    struct SortedMarketingNames
+    {
+        char       names[kNormalizedMarketingNamesLength]{}; ///< The normalized marketing names of all cards, in table order.
+        uint32_t   offsets[kCardInfoCount]{};                ///< Offset of the normalized marketing name of each card in names.
+        uint32_t   lengths[kCardInfoCount]{};                ///< Length of the normalized marketing name of each card.
+        CardHandle order[kCardInfoCount]{};                  ///< The cards, sorted by normalized marketing name, then table order.
+        size_t     nameCount   = 0;                          ///< Number of distinct normalized marketing names.
+        size_t     namesLength = 0;                          ///< Total length of the distinct normalized marketing names.
+
+        consteval SortedMarketingNames()
+        {
+            uint32_t offset = 0;
+            for (size_t i = 0; i < kCardInfoCount; ++i)
+            {
+                const std::string_view marketingName = kCardInfo[i].m_szMarketingName;
+
+                offsets[i] = offset;
+                lengths[i] = static_cast<uint32_t>(
+                    NormalizeName(marketingName.data(), marketingName.size(), names + offset, kNormalizedMarketingNamesLength - offset));
+                order[i] = static_cast<CardHandle>(i);
+                offset += lengths[i];
+            }
+
+            // Bottom-up merge sort, which is stable and so keeps the cards of each name in table order.
+            CardHandle  buffer[kCardInfoCount]{};
+            CardHandle *from = order;
+            CardHandle *to   = buffer;
+            for (size_t width = 1; width < kCardInfoCount; width *= 2)
+            {
+                for (size_t begin = 0; begin < kCardInfoCount; begin += 2 * width)
+                {
+                    const size_t middle = std::min(begin + width, kCardInfoCount);
+                    const size_t end    = std::min(begin + 2 * width, kCardInfoCount);
+
+                    size_t left  = begin;
+                    size_t right = middle;
+                    for (size_t out = begin; out < end; ++out)
+                    {
+                        if (right == end || (left < middle && !IsBefore(from[right], from[left])))
+                        {
+                            to[out] = from[left++];
+                        }
+                        else
+                        {
+                            to[out] = from[right++];
+                        }
+                    }
+                }
+
+                std::swap(from, to);
+            }
+
+            for (size_t i = 0; i < kCardInfoCount; ++i)
+            {
+                order[i] = from[i];
+                if (i == 0 || IsBefore(order[i - 1], order[i]))
+                {
+                    ++nameCount;
+                    namesLength += lengths[order[i]];
+                }
+            }
+        }
+
+        /// Get the normalized marketing name of a card.
+        [[nodiscard]] constexpr std::string_view Name(CardHandle card) const
+        {
+            return std::string_view(names + offsets[card], lengths[card]);
+        }
+
+        /// Query whether or not the normalized marketing name of one card sorts before the one of another card.
+        [[nodiscard]] constexpr bool IsBefore(CardHandle lhs, CardHandle rhs) const
+        {
+            return CompareNames(names + offsets[lhs], lengths[lhs], names + offsets[rhs], lengths[rhs]) < 0;
+        }
+    };
+
+    constexpr SortedMarketingNames kSortedMarketingNames; ///< The cards in order of their normalized marketing name.
+
+    /// The distinct normalized marketing names in sorted order and the cards with each of them.
+    template <size_t kNameCount, size_t kNamesLength>
+    struct MarketingNamePrefixIndex
+    {
+        /// A distinct normalized marketing name.
+        struct Name
+        {
+            uint32_t offset = 0; ///< Offset of the name in names.
+            uint32_t length = 0; ///< Length of the name.
+            uint32_t begin  = 0; ///< Index of the first card with the name in handles.
+            uint32_t end    = 0; ///< One past the index of the last card with the name in handles.
+        };
+
+        std::array<char, kNamesLength>         names{};   ///< The distinct normalized marketing names, in sorted order.
+        std::array<Name, kNameCount>           entries{}; ///< The distinct normalized marketing names.
+        std::array<CardHandle, kCardInfoCount> handles{}; ///< The cards, grouped by normalized marketing name.
+
+        consteval MarketingNamePrefixIndex()
+        {
+            const SortedMarketingNames &sorted = kSortedMarketingNames;
+
+            char       *nameChars  = names.data();
+            Name       *nameEntry  = entries.data();
+            CardHandle *cardHandle = handles.data();
+            size_t      nameIndex  = 0;
+            uint32_t    offset     = 0;
+
+            for (size_t i = 0; i < kCardInfoCount; ++i)
+            {
+                const CardHandle card = sorted.order[i];
+                if (i != 0 && sorted.IsBefore(sorted.order[i - 1], card))
+                {
+                    ++nameIndex;
+                }
+
+                Name &name = nameEntry[nameIndex];
+                if (name.end == 0)
+                {
+                    name = {offset, sorted.lengths[card], static_cast<uint32_t>(i), static_cast<uint32_t>(i)};
+                    for (uint32_t c = 0; c < sorted.lengths[card]; ++c)
+                    {
+                        nameChars[offset++] = sorted.names[sorted.offsets[card] + c];
+                    }
+                }
+
+                cardHandle[i] = card;
+                name.end      = static_cast<uint32_t>(i + 1);
+            }
+        }
+    };
+
+    constexpr MarketingNamePrefixIndex<kSortedMarketingNames.nameCount, kSortedMarketingNames.namesLength>
+        kMarketingNamePrefixIndex; ///< The distinct normalized marketing names in sorted order.
+
+    consteval std::array<AMDTDeviceInfoUtils::MarketingNameCompletion, kSortedMarketingNames.nameCount> MarketingNameCompletions()
+    {
+        const auto &index = kMarketingNamePrefixIndex;
+
+        std::array<AMDTDeviceInfoUtils::MarketingNameCompletion, kSortedMarketingNames.nameCount> completions{};
+        for (size_t i = 0; i < completions.size(); ++i)
+        {
+            const auto &name = index.entries[i];
+            completions[i]   = {std::string_view(index.names.data() + name.offset, name.length),
+                                kCardInfo[index.handles[name.begin]].m_szMarketingName,
+                                std::span<const CardHandle>(index.handles.data() + name.begin, name.end - name.begin)};
+        }
+
+        return completions;
+    }
+
+    constexpr auto kMarketingNameCompletions = MarketingNameCompletions(); ///< The distinct marketing names in sorted order of their normalized name.
+
+    /// Binary search the completions for one end of the range of names starting with a prefix.
+    /// The search tracks how many characters the prefix shares with the completions bounding the search range. Every completion in
+    /// between shares at least the smaller of the two, so those characters are skipped when comparing.
+    /// \param prefix the normalized prefix
+    /// \param first the index of the first completion to consider
+    /// \param isUpper false to skip the completions sorting before the prefix, true to also skip the ones starting with it
+    /// \return the index of the first completion that is not skipped
+    [[nodiscard]] size_t FindCompletionBound(std::string_view prefix, size_t first, bool isUpper)
+    {
+        // The range (lower, upper) is still open; lower is one past the candidate to avoid underflow.
+        size_t lower       = first;
+        size_t upper       = kMarketingNameCompletions.size() + 1;
+        size_t lowerShared = 0;
+        size_t upperShared = 0;
+
+        while (upper - lower > 1)
+        {
+            const size_t           middle = lower + (upper - lower) / 2;
+            const std::string_view name   = kMarketingNameCompletions[middle - 1].normalizedName;
+
+            size_t shared = std::min(lowerShared, upperShared);
+            while (shared < prefix.size() && shared < name.size() && name[shared] == prefix[shared])
+            {
+                ++shared;
+            }
+
+            // Compare the name truncated to the length of the prefix with the prefix.
+            int order = 0;
+            if (shared < prefix.size())
+            {
+                order = (shared == name.size() || static_cast<unsigned char>(name[shared]) < static_cast<unsigned char>(prefix[shared])) ? -1 : 1;
+            }
+
+            if (order < 0 || (isUpper && order == 0))
+            {
+                lower       = middle;
+                lowerShared = shared;
+            }
+            else
+            {
+                upper       = middle;
+                upperShared = shared;
+            }
+        }
+
+        return upper - 1;
+    }
+
+    constexpr size_t kTrigramLength   = 3;                                                     ///< Number of characters per trigram.
+    constexpr size_t kMaxNameTrigrams = 2 * (kMaxNormalizedNameLength - kTrigramLength + 1); ///< Upper bound on the trigrams of a card.
+
+    /// The distinct trigrams of a string or a set of strings.
+    struct Trigrams
+    {
+        uint64_t keys[kMaxNameTrigrams]{}; ///< Trigram keys, in order of first occurrence.
+        size_t   count = 0;                ///< Number of trigram keys.
+
+        /// Add the trigrams of a string.
+        constexpr void Add(const char *str, size_t size)
+        {
+            for (size_t i = 0; i + kTrigramLength <= size; ++i)
+            {
+                const uint64_t key = (uint64_t{static_cast<unsigned char>(str[i])} << 16) | (uint64_t{static_cast<unsigned char>(str[i + 1])} << 8) |
+                                     uint64_t{static_cast<unsigned char>(str[i + 2])};
+
+                size_t existing = 0;
+                while (existing < count && keys[existing] != key)
+                {
+                    ++existing;
+                }
+
+                if (existing == count)
+                {
+                    keys[count++] = key;
+                }
+            }
+        }
+
+        /// Add the trigrams of a normalized name.
+        constexpr void Add(const NormalizedName &name)
+        {
+            Add(name.buffer, name.length);
+        }
+    };
+
+    /// The distinct trigrams of the normalized marketing and CAL names of a card.
+    struct CardTrigrams : Trigrams
+    {
+        constexpr explicit CardTrigrams(const GDT_GfxCardInfo &card)
+        {
+            Add(NormalizedName(card.m_szMarketingName));
+            Add(NormalizedName(card.m_szCALName));
+        }
+    };
+
+    consteval size_t CountTrigramEntries()
+    {
+        size_t count = 0;
+        for (const GDT_GfxCardInfo &card : kCardInfo)
+        {
+            count += CardTrigrams(card).count;
+        }
+        return count;
+    }
+
+    constexpr size_t kTrigramEntryCount = CountTrigramEntries(); ///< Number of (trigram, card) pairs.
+
+    consteval std::array<KeyedCard, kTrigramEntryCount> TrigramKeys()
+    {
+        std::array<KeyedCard, kTrigramEntryCount> entries{};
+        size_t                                    entry = 0;
+        for (size_t i = 0; i < kCardInfoCount; ++i)
+        {
+            const CardTrigrams trigrams(kCardInfo[i]);
+            for (size_t t = 0; t < trigrams.count; ++t)
+            {
+                entries[entry++] = {trigrams.keys[t], static_cast<CardHandle>(i)};
+            }
+        }
+        return entries;
+    }
+
+    constexpr auto kTrigramKeys = TrigramKeys(); ///< Cards keyed by each trigram of their normalized names.
+
+    constexpr auto kTrigramIndex = BuildKeyIndex<SlotCountFor(CountDistinctKeys(kTrigramKeys))>(kTrigramKeys); ///< Trigram index over marketing and CAL names.
+
+    consteval size_t NormalizedCalNamesLength()
+    {
+        size_t length = 0;
+        for (const GDT_GfxCardInfo &card : kCardInfo)
+        {
+            length += NormalizedName(card.m_szCALName).length;
+        }
+        return length;
+    }
+
+    constexpr size_t kNormalizedCalNamesLength = NormalizedCalNamesLength(); ///< Total length of the normalized CAL names of all cards.
+
+    /// The normalized CAL names of all cards, so searches do not normalize them at run time.
+    struct NormalizedCalNames
+    {
+        char     names[kNormalizedCalNamesLength]{}; ///< The normalized CAL names of all cards, in table order.
+        uint32_t offsets[kCardInfoCount]{};          ///< Offset of the normalized CAL name of each card in names.
+        uint32_t lengths[kCardInfoCount]{};          ///< Length of the normalized CAL name of each card.
+
+        consteval NormalizedCalNames()
+        {
+            uint32_t offset = 0;
+            for (size_t i = 0; i < kCardInfoCount; ++i)
+            {
+                const std::string_view calName = kCardInfo[i].m_szCALName;
+
+                offsets[i] = offset;
+                lengths[i] = static_cast<uint32_t>(NormalizeName(calName.data(), calName.size(), names + offset, kNormalizedCalNamesLength - offset));
+                offset += lengths[i];
+            }
+        }
+
+        /// Get the normalized CAL name of a card.
+        [[nodiscard]] constexpr std::string_view Name(CardHandle card) const
+        {
+            return std::string_view(names + offsets[card], lengths[card]);
+        }
+    };
+
+    constexpr NormalizedCalNames kNormalizedCalNames; ///< The normalized CAL names of all cards.
+
+    /// Query whether or not a normalized query occurs in the normalized marketing or CAL name of a card.
+    [[nodiscard]] bool ContainsQuery(CardHandle card, std::string_view normalizedQuery)
+    {
+        return kSortedMarketingNames.Name(card).find(normalizedQuery) != std::string_view::npos ||
+               kNormalizedCalNames.Name(card).find(normalizedQuery) != std::string_view::npos;
+    }
+
+    /// Order matches from best to worst.
+    [[nodiscard]] bool IsBetterMatch(const AMDTDeviceInfoUtils::CardMatch &lhs, const AMDTDeviceInfoUtils::CardMatch &rhs)
+    {
+        if (lhs.isSubstring != rhs.isSubstring)
+        {
+            return lhs.isSubstring;
+        }
+        if (lhs.matchedTrigrams != rhs.matchedTrigrams)
+        {
+            return lhs.matchedTrigrams > rhs.matchedTrigrams;
+        }
+        return lhs.card < rhs.card;
+    }
+} // namespace
+
+std::string_view AMDTDeviceInfoUtils::NormalizeMarketingName(std::string_view marketingName, std::span<char> buffer)
+{
+    return std::string_view(buffer.data(), NormalizeName(marketingName.data(), marketingName.size(), buffer.data(), buffer.size()));
+}
+
+std::span<const CardHandle> AMDTDeviceInfoUtils::Internal::LookUpCardsByCalName(std::string_view calName, uint64_t hash)
+{
+    const std::span<const CardHandle> cards = kCalNameIndex.Find(hash);
+
+    // Rule out a hash collision with a name that is not in the table.
+    return (!cards.empty() && calName == gs_cardInfo[cards.front()].m_szCALName) ? cards : std::span<const CardHandle>();
+}
+
+std::span<const CardHandle> AMDTDeviceInfoUtils::Internal::LookUpCardsByMarketingName(std::string_view marketingName)
+{
+    char                   buffer[kMaxNormalizedNameLength];
+    const std::string_view normalizedName = NormalizeMarketingName(marketingName, buffer);
+
+    std::span<const CardHandle> cards = kMarketingNameIndex.Find(HashString(normalizedName));
+
+    // Rule out a hash collision with a name that is not in the table.
+    if (!cards.empty())
+    {
+        char nameBuffer[kMaxNormalizedNameLength];
+        if (NormalizeMarketingName(gs_cardInfo[cards.front()].m_szMarketingName, nameBuffer) != normalizedName)
+        {
+            cards = {};
+        }
+    }
+
+    return cards;
+}
+
+std::span<const CardHandle> AMDTDeviceInfoUtils::FindCardsByMarketingName(std::string_view marketingName)
+{
+    Internal::TraceLookup(LookupTraceApi::kMarketingName, marketingName);
+
+    const std::span<const CardHandle> cards = Internal::LookUpCardsByMarketingName(marketingName);
+    if (cards.empty())
+    {
+        Internal::RecordLookupMiss(LookupTraceApi::kMarketingName, marketingName);
+    }
+
+    return cards;
+}
+
+std::span<const CardHandle> AMDTDeviceInfoUtils::FindCardsByCalName(std::string_view calName)
+{
+    return Internal::LookUpCardsByCalName(calName, HashString(calName));
+}
+
+std::span<const AMDTDeviceInfoUtils::MarketingNameCompletion> AMDTDeviceInfoUtils::CompleteMarketingName(std::string_view prefix)
+{
+    char                   buffer[kMaxNormalizedNameLength];
+    const std::string_view normalizedPrefix(buffer, NormalizePrefix(prefix.data(), prefix.size(), buffer, kMaxNormalizedNameLength));
+
+    const size_t begin = FindCompletionBound(normalizedPrefix, 0, false);
+    const size_t end   = FindCompletionBound(normalizedPrefix, begin, true);
+
+    return std::span<const MarketingNameCompletion>(kMarketingNameCompletions).subspan(begin, end - begin);
+}
+
+size_t AMDTDeviceInfoUtils::SearchCards(std::string_view query, std::span<CardMatch> matches)
+{
+    const NormalizedName   normalized(query);
+    const std::string_view normalizedQuery = normalized.View();
+
+    std::array<CardMatch, kCardInfoCount> candidates;
+    size_t                                candidateCount = 0;
+
+    if (normalizedQuery.size() < kTrigramLength)
+    {
+        if (normalizedQuery.empty())
+        {
+            return 0;
+        }
+
+        for (size_t i = 0; i < kCardInfoCount; ++i)
+        {
+            if (ContainsQuery(static_cast<CardHandle>(i), normalizedQuery))
+            {
+                candidates[candidateCount++] = {static_cast<CardHandle>(i), 0, true};
+            }
+        }
+    }
+    else
+    {
+        Trigrams queryTrigrams;
+        queryTrigrams.Add(normalized);
+
+        std::array<uint16_t, kCardInfoCount> hits{};
+        CardSet                              hitCards;
+        for (size_t t = 0; t < queryTrigrams.count; ++t)
+        {
+            for (CardHandle card : kTrigramIndex.Find(queryTrigrams.keys[t]))
+            {
+                ++hits[card];
+                hitCards.Insert(card);
+            }
+        }
+
+        const size_t minHits = (queryTrigrams.count + 1) / 2;
+        for (CardHandle card : hitCards)
+        {
+            if (hits[card] >= minHits)
+            {
+                // Every trigram of a substring occurs in the name, so only those cards need to be compared.
+                const bool isSubstring = hits[card] == queryTrigrams.count && ContainsQuery(card, normalizedQuery);
+                candidates[candidateCount++] = {card, hits[card], isSubstring};
+            }
+        }
+    }
+
+    const size_t matchCount = std::min(candidateCount, matches.size());
+    std::partial_sort_copy(candidates.begin(), candidates.begin() + static_cast<std::ptrdiff_t>(candidateCount), matches.begin(),
+                           matches.begin() + static_cast<std::ptrdiff_t>(matchCount), IsBetterMatch);
+    return matchCount;
+}
@@ -0,0 +1,103 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Precomputed name indexes over the card table.
+//==============================================================================
+
+#ifndef DEVICE_INFO_DEVICE_INFO_NAME_INDEX_H_
+#define DEVICE_INFO_DEVICE_INFO_NAME_INDEX_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+#include "DeviceInfoQuery.h"
+
+namespace AMDTDeviceInfoUtils
+{
+    constexpr size_t kMaxNormalizedNameLength = 128; ///< Normalized names are truncated to this many characters.
+
+    /// Normalize a marketing name for tolerant matching.
+    /// The name is case folded, whitespace and parentheses are removed, trademark marks ("TM", "(R)", and their UTF-8 signs) are dropped
+    /// and "Graphic" is spelled "Graphics", so "AMD Radeon(TM) 860M Graphic" and "amd radeon tm 860m graphics" normalize to the same name.
+    /// \param[in] marketingName the marketing name to normalize, which does not need to be NUL terminated
+    /// \param[out] buffer the buffer to write the normalized name to; kMaxNormalizedNameLength characters are always enough
+    /// \return the normalized name, which is a view into buffer
+    [[nodiscard]] std::string_view NormalizeMarketingName(std::string_view marketingName, std::span<char> buffer);
+
+    /// Find the cards whose marketing name matches the specified name after normalization with NormalizeMarketingName.
+    /// \param[in] marketingName the marketing name to look for, which does not need to be NUL terminated
+    /// \return the matching cards in table order, empty if there are none
+    [[nodiscard]] std::span<const CardHandle> FindCardsByMarketingName(std::string_view marketingName);
+
+    /// Find the cards with the specified CAL name.
+    /// Unlike the CAL name lookups of DeviceInfoUtils.h, the name is compared as is: it is not translated with the device name translator.
+    /// \param[in] calName the CAL name to look for, which does not need to be NUL terminated
+    /// \return the matching cards in table order, empty if there are none
+    [[nodiscard]] std::span<const CardHandle> FindCardsByCalName(std::string_view calName);
+
+    /// How a name was matched by ResolveDeviceNames.
+    enum class DeviceNameMatch : uint8_t
+    {
+        kNone,          ///< The name was not found.
+        kCalName,       ///< The name is a CAL name, as looked up by GetDeviceInfo, IsAPU or GetHardwareGeneration.
+        kMarketingName, ///< The name is a marketing name, as looked up by FindCardsByMarketingName.
+    };
+
+    /// The result of resolving a device name with ResolveDeviceNames.
+    struct ResolvedDeviceName
+    {
+        std::span<const CardHandle> cards;                               ///< The cards with the name, in table order; empty if the name is not found.
+        const GDT_DeviceInfo       *deviceInfo = nullptr;                ///< The device info of the first card, including any override; nullptr if the name is not found.
+        GDT_HW_GENERATION           generation = GDT_HW_GENERATION_NONE; ///< The hardware generation of the first card.
+        bool                        isAPU      = false;                  ///< Whether the first card is an APU.
+        DeviceNameMatch             match      = DeviceNameMatch::kNone; ///< How the name was matched.
+    };
+
+    /// Look up a batch of device names, such as the names a driver reports for the devices of a node.
+    /// Each name is first looked up as a CAL name, translated like in GetDeviceInfo, IsAPU and GetHardwareGeneration, whose results
+    /// the first card matches, and then as a marketing name. The device name translator is read once per batch, every name is hashed
+    /// once, and a name repeated in the batch is translated and looked up only once, so this is the fastest way to resolve many names.
+    /// Nothing is allocated unless a translator installed with SetDeviceNameTranslator needs to copy a name.
+    /// \param[in] names the names to look up, which do not need to be NUL terminated
+    /// \param[out] results the result of each name, in the same order; must be at least as large as names
+    /// \return the number of names found
+    size_t ResolveDeviceNames(std::span<const std::string_view> names, std::span<ResolvedDeviceName> results);
+
+    /// A distinct marketing name returned by CompleteMarketingName.
+    struct MarketingNameCompletion
+    {
+        std::string_view            normalizedName; ///< The marketing name normalized with NormalizeMarketingName.
+        std::string_view            marketingName;  ///< The marketing name of the first card with the normalized name.
+        std::span<const CardHandle> cards;          ///< The cards with the normalized name, in table order.
+    };
+
+    /// Complete a marketing name, e.g. "AMD Radeon RX 90" to the names of all matching SKUs.
+    /// The prefix and the names are compared after normalization with NormalizeMarketingName, except that a trailing "R" or "TM"
+    /// in the prefix is kept as the possible beginning of a longer word. The completions are taken
+    /// from a precomputed sorted array with a binary search, so a query costs O(log n + k) for k completions.
+    /// \param[in] prefix the beginning of the marketing name, which does not need to be NUL terminated
+    /// \return the completions in order of their normalized name; all marketing names if the prefix is empty
+    [[nodiscard]] std::span<const MarketingNameCompletion> CompleteMarketingName(std::string_view prefix);
+
+    /// A card found by SearchCards.
+    struct CardMatch
+    {
+        CardHandle card;            ///< The matching card.
+        uint16_t   matchedTrigrams; ///< Number of distinct trigrams of the query that occur in the card's marketing or CAL name.
+        bool       isSubstring;     ///< True if the query occurs in the card's marketing or CAL name.
+    };
+
+    /// Search the marketing and CAL names of all cards for a fragment such as "9070" or "860M".
+    /// The query and the names are compared after normalization with NormalizeMarketingName, and only the cards sharing
+    /// at least half of the query's trigrams are considered. Queries shorter than three normalized characters are
+    /// matched as plain substrings of every name.
+    /// \param[in] query the fragment to search for, which does not need to be NUL terminated
+    /// \param[out] matches the best matches; cards containing the query come first, then cards sharing more trigrams, then table order
+    /// \return the number of matches written to matches
+    [[nodiscard]] size_t SearchCards(std::string_view query, std::span<CardMatch> matches);
+} // namespace AMDTDeviceInfoUtils
+
+#endif
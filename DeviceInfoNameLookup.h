@@ -0,0 +1,31 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Name index lookups shared by the single and the batch name lookups, without tracing or miss recording.
+//==============================================================================
+
+#ifndef DEVICE_INFO_DEVICE_INFO_NAME_LOOKUP_H_
+#define DEVICE_INFO_DEVICE_INFO_NAME_LOOKUP_H_
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+#include "DeviceInfoQuery.h"
+
+namespace AMDTDeviceInfoUtils::Internal
+{
+    /// Find the cards with a CAL name, see FindCardsByCalName.
+    /// \param calName the CAL name, which is not translated
+    /// \param hash the HashString hash of calName, so callers that already hashed the name do not hash it again
+    /// \return the matching cards in table order, empty if there are none
+    [[nodiscard]] std::span<const CardHandle> LookUpCardsByCalName(std::string_view calName, uint64_t hash);
+
+    /// Find the cards with a marketing name, see FindCardsByMarketingName.
+    /// \param marketingName the marketing name, which is normalized with NormalizeMarketingName
+    /// \return the matching cards in table order, empty if there are none
+    [[nodiscard]] std::span<const CardHandle> LookUpCardsByMarketingName(std::string_view marketingName);
+} // namespace AMDTDeviceInfoUtils::Internal
+
+#endif
@@ -0,0 +1,132 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Per-board overrides of the device info of an ASIC type.
+//==============================================================================
+
+#include "DeviceInfoOverride.h"
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "DeviceInfoLookupCache.h"
+
+namespace
+{
+    using AMDTDeviceInfoUtils::CardHandle;
+    using AMDTDeviceInfoUtils::DeviceInfoOverride;
+
+    constexpr uint16_t kNoOverride = UINT16_MAX; ///< Marks a card without an override.
+
+    /// An immutable set of overrides, merged with the device info of the cards they apply to.
+    struct OverrideSnapshot
+    {
+        std::array<uint16_t, kCardInfoCount> infoIndex; ///< Index of the merged device info of each card in infos, kNoOverride if none.
+        std::vector<GDT_DeviceInfo>          infos;     ///< The merged device info records.
+    };
+
+    std::atomic<const OverrideSnapshot *> gs_overrideSnapshot = nullptr; ///< The current overrides, nullptr if there are none.
+
+    std::mutex                                     gs_overrideMutex;     ///< Serializes the writers of gs_overrideSnapshot.
+    std::vector<std::unique_ptr<OverrideSnapshot>> gs_overrideSnapshots; ///< Every snapshot published since ReleaseRetiredDeviceInfoOverrides, kept alive since readers do not lock.
+
+    /// Apply the fields of an override to a device info record.
+    void ApplyOverride(const DeviceInfoOverride &override, GDT_DeviceInfo &info)
+    {
+        info.m_nNumShaderEngines = override.numShaderEngines.value_or(info.m_nNumShaderEngines);
+        info.m_nMaxWavePerSIMD   = override.maxWavePerSIMD.value_or(info.m_nMaxWavePerSIMD);
+        info.m_suClocksPrim      = override.suClocksPrim.value_or(info.m_suClocksPrim);
+        info.m_nNumSQMaxCounters = override.numSQMaxCounters.value_or(info.m_nNumSQMaxCounters);
+        info.m_nNumPrimPipes     = override.numPrimPipes.value_or(info.m_nNumPrimPipes);
+        info.m_nWaveSize         = override.waveSize.value_or(info.m_nWaveSize);
+        info.m_nNumSHPerSE       = override.numSHPerSE.value_or(info.m_nNumSHPerSE);
+        info.m_nNumCUs           = override.numCUs.value_or(info.m_nNumCUs);
+        info.m_nNumSIMDPerCU     = override.numSIMDPerCU.value_or(info.m_nNumSIMDPerCU);
+        info.m_nNumVGPRPerSIMD   = override.numVGPRPerSIMD.value_or(info.m_nNumVGPRPerSIMD);
+    }
+} // namespace
+
+size_t AMDTDeviceInfoUtils::SetDeviceInfoOverrides(std::span<const DeviceInfoOverride> overrides)
+{
+    std::unique_ptr<OverrideSnapshot> snapshot;
+
+    if (!overrides.empty())
+    {
+        snapshot = std::make_unique<OverrideSnapshot>();
+        snapshot->infoIndex.fill(kNoOverride);
+
+        // Apply the overrides for every revision first, so the ones for a specific revision take precedence.
+        for (const bool specificRevision : {false, true})
+        {
+            for (const DeviceInfoOverride &override : overrides)
+            {
+                if ((override.revisionID != kRevisionIdAny) != specificRevision)
+                {
+                    continue;
+                }
+
+                for (size_t card = 0; card < gs_cardInfo.size(); ++card)
+                {
+                    const GDT_GfxCardInfo &cardInfo = gs_cardInfo[card];
+                    if (cardInfo.m_deviceID != override.deviceID || (specificRevision && cardInfo.m_revID != override.revisionID))
+                    {
+                        continue;
+                    }
+
+                    uint16_t &infoIndex = snapshot->infoIndex[card];
+                    if (infoIndex == kNoOverride)
+                    {
+                        infoIndex = static_cast<uint16_t>(snapshot->infos.size());
+                        snapshot->infos.push_back(GetDeviceInfoForAsicType(cardInfo.m_asicType));
+                    }
+
+                    ApplyOverride(override, snapshot->infos[infoIndex]);
+                }
+            }
+        }
+
+        if (snapshot->infos.empty())
+        {
+            snapshot.reset();
+        }
+    }
+
+    const size_t overriddenCards = snapshot ? snapshot->infos.size() : 0;
+
+    std::lock_guard<std::mutex> lock(gs_overrideMutex);
+
+    // Keep the snapshot alive before publishing it, so readers never see a snapshot that is freed if push_back throws.
+    const OverrideSnapshot *published = snapshot.get();
+    if (snapshot)
+    {
+        gs_overrideSnapshots.push_back(std::move(snapshot));
+    }
+
+    gs_overrideSnapshot.store(published, std::memory_order_release);
+    AMDTDeviceInfoUtils::Internal::InvalidateLookupCaches();
+
+    return overriddenCards;
+}
+
+void AMDTDeviceInfoUtils::ReleaseRetiredDeviceInfoOverrides()
+{
+    std::lock_guard<std::mutex> lock(gs_overrideMutex);
+
+    const OverrideSnapshot *current = gs_overrideSnapshot.load(std::memory_order_relaxed);
+    std::erase_if(gs_overrideSnapshots, [current](const std::unique_ptr<OverrideSnapshot> &snapshot) { return snapshot.get() != current; });
+}
+
+const GDT_DeviceInfo &AMDTDeviceInfoUtils::GetCardDeviceInfo(CardHandle card)
+{
+    const OverrideSnapshot *snapshot = gs_overrideSnapshot.load(std::memory_order_acquire);
+    if (nullptr != snapshot && snapshot->infoIndex[card] != kNoOverride)
+    {
+        return snapshot->infos[snapshot->infoIndex[card]];
+    }
+
+    return GetDeviceInfoForAsicType(gs_cardInfo[card].m_asicType);
+}
@@ -0,0 +1,61 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Per-board overrides of the device info of an ASIC type.
+//==============================================================================
+
+#ifndef DEVICE_INFO_DEVICE_INFO_OVERRIDE_H_
+#define DEVICE_INFO_DEVICE_INFO_OVERRIDE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+#include "DeviceInfoQuery.h"
+#include "DeviceInfoUtils.h"
+
+namespace AMDTDeviceInfoUtils
+{
+    /// Replaces fields of the GDT_DeviceInfo of the boards with a device ID and revision ID, e.g. the number of enabled CUs of a harvested SKU.
+    /// Fields without a value keep the value of the ASIC type.
+    struct DeviceInfoOverride
+    {
+        uint32_t deviceID   = 0;              ///< Device ID of the boards to override.
+        uint32_t revisionID = kRevisionIdAny; ///< Revision ID of the boards to override, kRevisionIdAny for every revision of the device ID.
+
+        std::optional<uint8_t>  numShaderEngines; ///< Replaces GDT_DeviceInfo::m_nNumShaderEngines.
+        std::optional<uint8_t>  maxWavePerSIMD;   ///< Replaces GDT_DeviceInfo::m_nMaxWavePerSIMD.
+        std::optional<uint8_t>  suClocksPrim;     ///< Replaces GDT_DeviceInfo::m_suClocksPrim.
+        std::optional<uint8_t>  numSQMaxCounters; ///< Replaces GDT_DeviceInfo::m_nNumSQMaxCounters.
+        std::optional<uint8_t>  numPrimPipes;     ///< Replaces GDT_DeviceInfo::m_nNumPrimPipes.
+        std::optional<uint8_t>  waveSize;         ///< Replaces GDT_DeviceInfo::m_nWaveSize.
+        std::optional<uint8_t>  numSHPerSE;       ///< Replaces GDT_DeviceInfo::m_nNumSHPerSE.
+        std::optional<uint8_t>  numCUs;           ///< Replaces GDT_DeviceInfo::m_nNumCUs.
+        std::optional<uint8_t>  numSIMDPerCU;     ///< Replaces GDT_DeviceInfo::m_nNumSIMDPerCU.
+        std::optional<uint16_t> numVGPRPerSIMD;   ///< Replaces GDT_DeviceInfo::m_nNumVGPRPerSIMD.
+    };
+
+    /// Replace the registered overrides.
+    /// The overrides are merged with the device info of each card they apply to once, here, so GetDeviceInfo by device ID returns the merged
+    /// record with a single lookup and the derived metrics of GDT_DeviceInfo, such as numberSIMDs(), reflect the overrides. An override for a
+    /// specific revision ID is applied on top of one for kRevisionIdAny. Lookups may run concurrently with this function. Replaced sets of
+    /// overrides stay allocated until ReleaseRetiredDeviceInfoOverrides is called, so references returned by GetCardDeviceInfo stay valid.
+    /// \param[in] overrides the overrides, replacing all previously registered ones; empty to remove every override
+    /// \return the number of cards in the card info table that the overrides apply to
+    size_t SetDeviceInfoOverrides(std::span<const DeviceInfoOverride> overrides);
+
+    /// Free the sets of overrides that were replaced by SetDeviceInfoOverrides.
+    /// Lookups read the registered overrides without locking, so replaced sets are kept for lookups that may still be reading them. Call this
+    /// only while no lookup runs on any thread, e.g. after joining the threads that made lookups; references returned by GetCardDeviceInfo
+    /// before the overrides were last replaced are invalid afterwards.
+    void ReleaseRetiredDeviceInfoOverrides();
+
+    /// Get the device info of a card, including any registered override.
+    /// \param[in] card the card
+    /// \return the overridden device info of the card, or the device info of its ASIC type if there is no override
+    [[nodiscard]] const GDT_DeviceInfo &GetCardDeviceInfo(CardHandle card);
+} // namespace AMDTDeviceInfoUtils
+
+#endif
@@ -0,0 +1,273 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Attribute and configuration queries over the card table.
+//==============================================================================
+
+#include "DeviceInfoQuery.h"
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+
+#include "DeviceInfoIndex.h"
+#include "DeviceInfoTable.h"
+
+namespace
+{
+    using AMDTDeviceInfoUtils::CardHandle;
+    using AMDTDeviceInfoUtils::CardSet;
+
+    constexpr size_t kMaxWaveSizeLog2      = 8;  ///< Wavefront sizes up to 2^kMaxWaveSizeLog2 are indexed.
+    constexpr size_t kMaxShaderEngineCount = 16; ///< Shader engine counts up to this value are indexed.
+    constexpr size_t kCuBucketWidth        = 8;  ///< Number of compute unit counts per bucket.
+    constexpr size_t kCuBucketCount        = (std::numeric_limits<decltype(GDT_DeviceInfo::m_nNumCUs)>::max() + 1) / kCuBucketWidth;
+
+    /// Precomputed per-attribute card sets.
+    struct CardAttributeIndex
+    {
+        CardSet                                        all;               ///< Every card.
+        std::array<CardSet, GDT_HW_GENERATION_LAST>    generation;        ///< Cards per hardware generation.
+        std::array<CardSet, GDT_LAST>                  asicType;          ///< Cards per ASIC type.
+        CardSet                                        apu;               ///< APU cards.
+        std::array<CardSet, kMaxWaveSizeLog2 + 1>      waveSize;          ///< Cards per log2 of the wavefront size.
+        std::array<CardSet, kMaxShaderEngineCount + 1> shaderEngineCount; ///< Cards per shader engine count.
+        std::array<CardSet, kCuBucketCount + 1>        minCuBucket;       ///< Cards with at least (bucket * kCuBucketWidth) compute units.
+    };
+
+    consteval CardAttributeIndex BuildCardAttributeIndex()
+    {
+        CardAttributeIndex index;
+        index.all = CardSet::All();
+
+        for (size_t i = 0; i < kCardInfoCount; ++i)
+        {
+            const GDT_GfxCardInfo &card = kCardInfo[i];
+            const GDT_DeviceInfo  &info = kDeviceInfo[static_cast<size_t>(card.m_asicType)];
+            const auto             handle = static_cast<CardHandle>(i);
+
+            index.generation[static_cast<size_t>(card.m_generation)].Insert(handle);
+            index.asicType[static_cast<size_t>(card.m_asicType)].Insert(handle);
+
+            if (card.m_bAPU)
+            {
+                index.apu.Insert(handle);
+            }
+
+            if (std::has_single_bit(info.m_nWaveSize))
+            {
+                index.waveSize[static_cast<size_t>(std::countr_zero(info.m_nWaveSize))].Insert(handle);
+            }
+
+            // Indexing out of range fails the constant evaluation, so the build breaks if a card outgrows the index.
+            index.shaderEngineCount[info.m_nNumShaderEngines].Insert(handle);
+
+            for (size_t bucket = 0; bucket <= info.m_nNumCUs / kCuBucketWidth; ++bucket)
+            {
+                index.minCuBucket[bucket].Insert(handle);
+            }
+        }
+
+        return index;
+    }
+
+    constexpr CardAttributeIndex kCardAttributeIndex = BuildCardAttributeIndex(); ///< The attribute index over kCardInfo.
+
+    constexpr CardSet kEmptyCardSet; ///< Returned for attribute values that no card has.
+
+    using namespace AMDTDeviceInfoUtils::Internal;
+
+    /// Pack a hardware configuration into a key.
+    /// \return the key, or std::nullopt if a field is too large for any GDT_DeviceInfo to have it
+    [[nodiscard]] constexpr std::optional<uint64_t> HardwareConfigKey(const AMDTDeviceInfoUtils::HardwareConfig &config)
+    {
+        if (config.numCUs > UINT8_MAX || config.numShaderEngines > UINT8_MAX || config.numSHPerSE > UINT8_MAX || config.waveSize > UINT8_MAX)
+        {
+            return std::nullopt;
+        }
+
+        return uint64_t{config.numCUs} | (uint64_t{config.numShaderEngines} << 8) | (uint64_t{config.numSHPerSE} << 16) | (uint64_t{config.waveSize} << 24);
+    }
+
+    /// Get the hardware configuration of an ASIC type.
+    [[nodiscard]] constexpr AMDTDeviceInfoUtils::HardwareConfig AsicConfig(const GDT_DeviceInfo &info)
+    {
+        return {info.m_nNumCUs, info.m_nNumShaderEngines, info.m_nNumSHPerSE, info.m_nWaveSize};
+    }
+
+    consteval std::array<KeyedValue<GDT_HW_ASIC_TYPE>, GDT_LAST> AsicConfigKeys()
+    {
+        std::array<KeyedValue<GDT_HW_ASIC_TYPE>, GDT_LAST> entries{};
+        for (size_t i = 0; i < GDT_LAST; ++i)
+        {
+            entries[i] = {HardwareConfigKey(AsicConfig(kDeviceInfo[i])).value(), static_cast<GDT_HW_ASIC_TYPE>(i)};
+        }
+        return entries;
+    }
+
+    constexpr auto kAsicConfigKeys = AsicConfigKeys(); ///< ASIC types keyed by their hardware configuration.
+
+    constexpr auto kAsicConfigIndex = BuildKeyIndex<SlotCountFor(CountDistinctKeys(kAsicConfigKeys))>(kAsicConfigKeys); ///< Hardware configuration index.
+
+    consteval std::array<KeyedCard, kCardInfoCount> DeviceIdKeys()
+    {
+        std::array<KeyedCard, kCardInfoCount> entries{};
+        for (size_t i = 0; i < kCardInfoCount; ++i)
+        {
+            entries[i] = {kCardInfo[i].m_deviceID, static_cast<CardHandle>(i)};
+        }
+        return entries;
+    }
+
+    constexpr auto kDeviceIdKeys = DeviceIdKeys(); ///< Cards keyed by their device ID.
+
+    constexpr auto kDeviceIdIndex = BuildKeyIndex<SlotCountFor(CountDistinctKeys(kDeviceIdKeys))>(kDeviceIdKeys); ///< Device ID index.
+
+    /// Get the relative difference between an observed and an actual configuration field.
+    /// \return the difference in thousandths, 0 if the observed value is unknown
+    [[nodiscard]] constexpr uint32_t FieldDistance(uint32_t observed, uint32_t actual)
+    {
+        if (observed == 0 || observed == actual)
+        {
+            return 0;
+        }
+
+        const uint64_t difference = (observed > actual) ? observed - actual : actual - observed;
+        return static_cast<uint32_t>(difference * 1000 / std::max(observed, actual));
+    }
+} // namespace
+
+const CardSet &AMDTDeviceInfoUtils::AllCards()
+{
+    return kCardAttributeIndex.all;
+}
+
+const CardSet &AMDTDeviceInfoUtils::CardsInHardwareGeneration(GDT_HW_GENERATION gen)
+{
+    if (static_cast<size_t>(gen) >= GDT_HW_GENERATION_LAST)
+    {
+        return kEmptyCardSet;
+    }
+
+    return kCardAttributeIndex.generation[static_cast<size_t>(gen)];
+}
+
+const CardSet &AMDTDeviceInfoUtils::CardsWithAsicType(GDT_HW_ASIC_TYPE asicType)
+{
+    if (asicType <= GDT_ASIC_TYPE_NONE || asicType >= GDT_LAST)
+    {
+        return kEmptyCardSet;
+    }
+
+    return kCardAttributeIndex.asicType[static_cast<size_t>(asicType)];
+}
+
+const CardSet &AMDTDeviceInfoUtils::ApuCards()
+{
+    return kCardAttributeIndex.apu;
+}
+
+const CardSet &AMDTDeviceInfoUtils::CardsWithWaveSize(uint32_t waveSize)
+{
+    if (!std::has_single_bit(waveSize) || static_cast<size_t>(std::countr_zero(waveSize)) > kMaxWaveSizeLog2)
+    {
+        return kEmptyCardSet;
+    }
+
+    return kCardAttributeIndex.waveSize[static_cast<size_t>(std::countr_zero(waveSize))];
+}
+
+const CardSet &AMDTDeviceInfoUtils::CardsWithShaderEngineCount(uint32_t numShaderEngines)
+{
+    if (numShaderEngines > kMaxShaderEngineCount)
+    {
+        return kEmptyCardSet;
+    }
+
+    return kCardAttributeIndex.shaderEngineCount[numShaderEngines];
+}
+
+CardSet AMDTDeviceInfoUtils::CardsWithMinCUs(uint32_t minCUs)
+{
+    const size_t bucket = minCUs / kCuBucketWidth;
+
+    if (bucket >= kCuBucketCount)
+    {
+        return kEmptyCardSet;
+    }
+
+    if (minCUs % kCuBucketWidth == 0)
+    {
+        return kCardAttributeIndex.minCuBucket[bucket];
+    }
+
+    // Only the cards in the bucket containing minCUs need to be checked individually.
+    CardSet result = kCardAttributeIndex.minCuBucket[bucket + 1];
+    for (CardHandle card : kCardAttributeIndex.minCuBucket[bucket] - result)
+    {
+        if (kDeviceInfo[static_cast<size_t>(kCardInfo[card].m_asicType)].m_nNumCUs >= minCUs)
+        {
+            result.Insert(card);
+        }
+    }
+
+    return result;
+}
+
+CardSet AMDTDeviceInfoUtils::CardsWithMaxCUs(uint32_t maxCUs)
+{
+    if (maxCUs == std::numeric_limits<uint32_t>::max())
+    {
+        return kCardAttributeIndex.all;
+    }
+
+    return ~CardsWithMinCUs(maxCUs + 1);
+}
+
+std::span<const CardHandle> AMDTDeviceInfoUtils::FindCardsByDeviceId(uint32_t deviceID)
+{
+    return kDeviceIdIndex.Find(deviceID);
+}
+
+std::span<const GDT_HW_ASIC_TYPE> AMDTDeviceInfoUtils::AsicTypesWithConfig(const HardwareConfig &config)
+{
+    const std::optional<uint64_t> key = HardwareConfigKey(config);
+    if (!key.has_value())
+    {
+        return {};
+    }
+
+    return kAsicConfigIndex.Find(*key);
+}
+
+CardSet AMDTDeviceInfoUtils::CardsWithConfig(const HardwareConfig &config)
+{
+    CardSet cards;
+    for (GDT_HW_ASIC_TYPE asicType : AsicTypesWithConfig(config))
+    {
+        cards |= kCardAttributeIndex.asicType[static_cast<size_t>(asicType)];
+    }
+
+    return cards;
+}
+
+size_t AMDTDeviceInfoUtils::FindNearestAsicTypes(const HardwareConfig &config, std::span<AsicConfigMatch> matches)
+{
+    std::array<AsicConfigMatch, GDT_LAST> candidates;
+    for (size_t i = 0; i < GDT_LAST; ++i)
+    {
+        const HardwareConfig actual = AsicConfig(kDeviceInfo[i]);
+
+        candidates[i] = {static_cast<GDT_HW_ASIC_TYPE>(i),
+                         FieldDistance(config.numCUs, actual.numCUs) + FieldDistance(config.numShaderEngines, actual.numShaderEngines) +
+                             FieldDistance(config.numSHPerSE, actual.numSHPerSE) + FieldDistance(config.waveSize, actual.waveSize)};
+    }
+
+    auto is_nearer = [](const AsicConfigMatch &lhs, const AsicConfigMatch &rhs)
+    { return lhs.distance != rhs.distance ? lhs.distance < rhs.distance : lhs.asicType < rhs.asicType; };
+
+    const size_t matchCount = std::min(candidates.size(), matches.size());
+    std::partial_sort_copy(candidates.begin(), candidates.end(), matches.begin(), matches.begin() + static_cast<std::ptrdiff_t>(matchCount), is_nearer);
+    return matchCount;
+}
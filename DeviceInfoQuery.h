@@ -0,0 +1,366 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Attribute and configuration queries and allocation-free iteration over the card table.
+//==============================================================================
+
+#ifndef DEVICE_INFO_DEVICE_INFO_QUERY_H_
+#define DEVICE_INFO_DEVICE_INFO_QUERY_H_
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <span>
+#include <type_traits>
+
+#include "DeviceInfo.h"
+
+namespace AMDTDeviceInfoUtils
+{
+    /// Handle to a card, which is the index of the card in gs_cardInfo.
+    using CardHandle = uint16_t;
+
+    static_assert(kCardInfoCount <= UINT16_MAX, "CardHandle is too narrow to address every entry in the card info table.");
+
+    /// A set of cards, stored as one bit per entry in gs_cardInfo.
+    /// Sets are combined with the bitwise operators and iterated as ascending card handles.
+    class CardSet
+    {
+    public:
+        static constexpr size_t kBitsPerWord = 64;                                                   ///< Number of cards per storage word.
+        static constexpr size_t kWordCount   = (kCardInfoCount + kBitsPerWord - 1) / kBitsPerWord; ///< Number of storage words.
+
+        /// Forward iterator over the card handles in a set.
+        class Iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = CardHandle;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = void;
+            using reference         = CardHandle;
+
+            constexpr Iterator() = default;
+
+            /// Constructor
+            /// \param set the set to iterate
+            /// \param wordIndex the storage word to start at, kWordCount for the end iterator
+            constexpr Iterator(const CardSet *set, size_t wordIndex)
+                : m_set(set)
+                , m_wordIndex(wordIndex)
+                , m_bits(wordIndex < kWordCount ? set->m_words[wordIndex] : 0)
+            {
+                SkipEmptyWords();
+            }
+
+            [[nodiscard]] constexpr CardHandle operator*() const
+            {
+                return static_cast<CardHandle>(m_wordIndex * kBitsPerWord + static_cast<size_t>(std::countr_zero(m_bits)));
+            }
+
+            constexpr Iterator &operator++()
+            {
+                m_bits &= m_bits - 1;
+                SkipEmptyWords();
+                return *this;
+            }
+
+            constexpr Iterator operator++(int)
+            {
+                Iterator previous = *this;
+                ++*this;
+                return previous;
+            }
+
+            [[nodiscard]] constexpr bool operator==(const Iterator &other) const
+            {
+                return m_wordIndex == other.m_wordIndex && m_bits == other.m_bits;
+            }
+
+        private:
+            /// Advance to the next storage word that has a card left in it.
+            constexpr void SkipEmptyWords()
+            {
+                while (m_bits == 0 && m_wordIndex < kWordCount)
+                {
+                    ++m_wordIndex;
+                    m_bits = m_wordIndex < kWordCount ? m_set->m_words[m_wordIndex] : 0;
+                }
+            }
+
+            const CardSet *m_set       = nullptr;    ///< The set being iterated.
+            size_t         m_wordIndex = kWordCount; ///< Index of the current storage word.
+            uint64_t       m_bits      = 0;          ///< Cards of the current storage word that have not been visited yet.
+        };
+
+        constexpr CardSet() = default;
+
+        /// Get a set containing every card in the card info table.
+        [[nodiscard]] static constexpr CardSet All()
+        {
+            CardSet all;
+            all.m_words.fill(~uint64_t{0});
+            all.ClearUnusedBits();
+            return all;
+        }
+
+        /// Add a card to the set.
+        /// \param card the card to add
+        constexpr void Insert(CardHandle card)
+        {
+            m_words[card / kBitsPerWord] |= uint64_t{1} << (card % kBitsPerWord);
+        }
+
+        /// Remove a card from the set.
+        /// \param card the card to remove
+        constexpr void Erase(CardHandle card)
+        {
+            m_words[card / kBitsPerWord] &= ~(uint64_t{1} << (card % kBitsPerWord));
+        }
+
+        /// Query whether or not a card is in the set.
+        /// \param card the card to look for
+        /// \return true if the card is in the set
+        [[nodiscard]] constexpr bool Contains(CardHandle card) const
+        {
+            return card < kCardInfoCount && ((m_words[card / kBitsPerWord] >> (card % kBitsPerWord)) & 1) != 0;
+        }
+
+        /// Get the number of cards in the set.
+        [[nodiscard]] constexpr size_t Count() const
+        {
+            size_t count = 0;
+            for (uint64_t word : m_words)
+            {
+                count += static_cast<size_t>(std::popcount(word));
+            }
+            return count;
+        }
+
+        /// Query whether or not the set is empty.
+        [[nodiscard]] constexpr bool Empty() const
+        {
+            uint64_t any = 0;
+            for (uint64_t word : m_words)
+            {
+                any |= word;
+            }
+            return any == 0;
+        }
+
+        constexpr CardSet &operator&=(const CardSet &other)
+        {
+            for (size_t i = 0; i < kWordCount; ++i)
+            {
+                m_words[i] &= other.m_words[i];
+            }
+            return *this;
+        }
+
+        constexpr CardSet &operator|=(const CardSet &other)
+        {
+            for (size_t i = 0; i < kWordCount; ++i)
+            {
+                m_words[i] |= other.m_words[i];
+            }
+            return *this;
+        }
+
+        /// Remove every card of another set from this set.
+        constexpr CardSet &operator-=(const CardSet &other)
+        {
+            for (size_t i = 0; i < kWordCount; ++i)
+            {
+                m_words[i] &= ~other.m_words[i];
+            }
+            return *this;
+        }
+
+        [[nodiscard]] friend constexpr CardSet operator&(CardSet lhs, const CardSet &rhs)
+        {
+            return lhs &= rhs;
+        }
+
+        [[nodiscard]] friend constexpr CardSet operator|(CardSet lhs, const CardSet &rhs)
+        {
+            return lhs |= rhs;
+        }
+
+        [[nodiscard]] friend constexpr CardSet operator-(CardSet lhs, const CardSet &rhs)
+        {
+            return lhs -= rhs;
+        }
+
+        /// Get the set of all cards that are not in this set.
+        [[nodiscard]] constexpr CardSet operator~() const
+        {
+            CardSet complement;
+            for (size_t i = 0; i < kWordCount; ++i)
+            {
+                complement.m_words[i] = ~m_words[i];
+            }
+            complement.ClearUnusedBits();
+            return complement;
+        }
+
+        [[nodiscard]] constexpr bool operator==(const CardSet &other) const = default;
+
+        [[nodiscard]] constexpr Iterator begin() const
+        {
+            return Iterator(this, 0);
+        }
+
+        [[nodiscard]] constexpr Iterator end() const
+        {
+            return Iterator(this, kWordCount);
+        }
+
+    private:
+        /// Clear the bits of the last storage word that do not correspond to a card.
+        constexpr void ClearUnusedBits()
+        {
+            constexpr size_t kUsedBits = kCardInfoCount % kBitsPerWord;
+            if constexpr (kUsedBits != 0)
+            {
+                m_words[kWordCount - 1] &= (uint64_t{1} << kUsedBits) - 1;
+            }
+        }
+
+        std::array<uint64_t, kWordCount> m_words{}; ///< One bit per card.
+    };
+
+    /// Get the set of all cards.
+    /// \return the set of every card in the card info table
+    [[nodiscard]] const CardSet &AllCards();
+
+    /// Get the set of cards from the specified hardware generation.
+    /// \param[in] gen Hardware generation
+    /// \return the matching cards, empty if the generation is unknown
+    [[nodiscard]] const CardSet &CardsInHardwareGeneration(GDT_HW_GENERATION gen);
+
+    /// Get the set of cards with the specified ASIC type.
+    /// \param[in] asicType ASIC type
+    /// \return the matching cards, empty if the ASIC type is unknown
+    [[nodiscard]] const CardSet &CardsWithAsicType(GDT_HW_ASIC_TYPE asicType);
+
+    /// Get the set of cards that are APUs. Complement it to get the discrete cards.
+    /// \return the APU cards
+    [[nodiscard]] const CardSet &ApuCards();
+
+    /// Get the set of cards with the specified wavefront size.
+    /// \param[in] waveSize Wavefront size
+    /// \return the matching cards, empty if no card has the wavefront size
+    [[nodiscard]] const CardSet &CardsWithWaveSize(uint32_t waveSize);
+
+    /// Get the set of cards with the specified number of shader engines.
+    /// \param[in] numShaderEngines Number of shader engines
+    /// \return the matching cards, empty if no card has that many shader engines
+    [[nodiscard]] const CardSet &CardsWithShaderEngineCount(uint32_t numShaderEngines);
+
+    /// Get the set of cards with at least the specified number of compute units.
+    /// \param[in] minCUs Minimum number of compute units
+    /// \return the matching cards
+    [[nodiscard]] CardSet CardsWithMinCUs(uint32_t minCUs);
+
+    /// Get the set of cards with at most the specified number of compute units.
+    /// \param[in] maxCUs Maximum number of compute units
+    /// \return the matching cards
+    [[nodiscard]] CardSet CardsWithMaxCUs(uint32_t maxCUs);
+
+    /// Find the cards with a device ID.
+    /// \param[in] deviceID Device ID
+    /// \return the matching cards in table order, one per revision ID, empty if there are none
+    [[nodiscard]] std::span<const CardHandle> FindCardsByDeviceId(uint32_t deviceID);
+
+    /// A hardware configuration as reported by a runtime, e.g. for a virtualized or partitioned GPU whose PCI ID is not known.
+    struct HardwareConfig
+    {
+        uint32_t numCUs           = 0; ///< Number of compute units.
+        uint32_t numShaderEngines = 0; ///< Number of shader engines.
+        uint32_t numSHPerSE       = 0; ///< Number of shader arrays per shader engine.
+        uint32_t waveSize         = 0; ///< Wavefront size.
+    };
+
+    /// Get the ASIC types whose GDT_DeviceInfo has exactly the specified configuration.
+    /// \param[in] config the hardware configuration
+    /// \return the matching ASIC types in enum order, empty if there are none
+    [[nodiscard]] std::span<const GDT_HW_ASIC_TYPE> AsicTypesWithConfig(const HardwareConfig &config);
+
+    /// Get the set of cards whose ASIC type has exactly the specified configuration.
+    /// \param[in] config the hardware configuration
+    /// \return the matching cards
+    [[nodiscard]] CardSet CardsWithConfig(const HardwareConfig &config);
+
+    /// An ASIC type found by FindNearestAsicTypes.
+    struct AsicConfigMatch
+    {
+        GDT_HW_ASIC_TYPE asicType; ///< The ASIC type.
+        uint32_t         distance; ///< Sum of the relative differences of the known configuration fields, in thousandths; 0 for an exact match.
+    };
+
+    /// Rank the ASIC types by how close their configuration is to a partially known configuration.
+    /// Fields of config that are 0 are unknown and ignored. Every other field adds its relative difference to the ASIC type's
+    /// value, |observed - actual| / max(observed, actual), to the distance.
+    /// \param[in] config the hardware configuration
+    /// \param[out] matches the nearest ASIC types by ascending distance, then enum order
+    /// \return the number of matches written to matches
+    [[nodiscard]] size_t FindNearestAsicTypes(const HardwareConfig &config, std::span<AsicConfigMatch> matches);
+
+    /// Pass a card to a visitor.
+    /// \param visitor callable taking a const GDT_GfxCardInfo reference, optionally returning bool
+    /// \param card the card to visit
+    /// \return false if the visitor asked to stop iterating, true otherwise
+    template <typename Visitor>
+    [[nodiscard]] inline bool VisitCard(Visitor &visitor, const GDT_GfxCardInfo &card)
+    {
+        if constexpr (std::is_void_v<std::invoke_result_t<Visitor &, const GDT_GfxCardInfo &>>)
+        {
+            visitor(card);
+            return true;
+        }
+        else
+        {
+            return static_cast<bool>(visitor(card));
+        }
+    }
+
+    /// Visit every card that satisfies a predicate, in table order, without materializing a list of cards.
+    /// \param predicate callable taking a const GDT_GfxCardInfo reference and returning true for the cards to visit
+    /// \param visitor callable taking a const GDT_GfxCardInfo reference; if it returns bool, returning false stops the iteration
+    /// \return false if the visitor stopped the iteration early, true otherwise
+    template <std::predicate<const GDT_GfxCardInfo &> Predicate, typename Visitor>
+    inline bool ForEachCard(Predicate &&predicate, Visitor &&visitor)
+    {
+        for (const GDT_GfxCardInfo &card : gs_cardInfo)
+        {
+            if (predicate(card) && !VisitCard(visitor, card))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// Visit every card in a set, in table order.
+    /// \param cards the cards to visit
+    /// \param visitor callable taking a const GDT_GfxCardInfo reference; if it returns bool, returning false stops the iteration
+    /// \return false if the visitor stopped the iteration early, true otherwise
+    template <typename Visitor>
+    inline bool ForEachCard(const CardSet &cards, Visitor &&visitor)
+    {
+        for (CardHandle card : cards)
+        {
+            if (!VisitCard(visitor, gs_cardInfo[card]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+} // namespace AMDTDeviceInfoUtils
+
+#endif
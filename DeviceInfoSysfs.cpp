@@ -0,0 +1,201 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Enumeration of the local AMD GPUs through Linux sysfs.
+//==============================================================================
+
+#include "DeviceInfoSysfs.h"
+
+#include <algorithm>
+#include <charconv>
+#include <string_view>
+#include <utility>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "DeviceInfoUtils.h"
+#include "DeviceInfoVendor.h"
+
+namespace
+{
+    constexpr uint32_t kDisplayControllerClass = 0x03; ///< PCI base class of display controllers.
+
+    /// Owns a file descriptor.
+    class FileDescriptor
+    {
+    public:
+        explicit FileDescriptor(int fd)
+            : m_fd(fd)
+        {
+        }
+
+        FileDescriptor(const FileDescriptor &)            = delete;
+        FileDescriptor &operator=(const FileDescriptor &) = delete;
+
+        ~FileDescriptor()
+        {
+            if (m_fd >= 0)
+            {
+                close(m_fd);
+            }
+        }
+
+        [[nodiscard]] int Get() const
+        {
+            return m_fd;
+        }
+
+        /// Give up ownership of the file descriptor.
+        [[nodiscard]] int Release()
+        {
+            return std::exchange(m_fd, -1);
+        }
+
+    private:
+        int m_fd; ///< The file descriptor, negative if none.
+    };
+
+    /// Read a sysfs attribute holding a hexadecimal number, such as "0x1002\n".
+    /// \param directoryFd the device directory
+    /// \param name the name of the attribute
+    /// \return the number, or std::nullopt if the attribute cannot be read or parsed
+    std::optional<uint32_t> ReadHexAttribute(int directoryFd, const char *name)
+    {
+        const FileDescriptor file(openat(directoryFd, name, O_RDONLY | O_CLOEXEC));
+        if (file.Get() < 0)
+        {
+            return std::nullopt;
+        }
+
+        char          buffer[32];
+        const ssize_t size = read(file.Get(), buffer, sizeof(buffer));
+        if (size <= 0)
+        {
+            return std::nullopt;
+        }
+
+        std::string_view text(buffer, static_cast<size_t>(size));
+        if (text.starts_with("0x") || text.starts_with("0X"))
+        {
+            text.remove_prefix(2);
+        }
+
+        uint32_t   value  = 0;
+        const auto result = std::from_chars(text.data(), text.data() + text.size(), value, 16);
+        if (result.ec != std::errc() || result.ptr == text.data())
+        {
+            return std::nullopt;
+        }
+
+        return value;
+    }
+
+    /// Read the IDs of a PCI device if it is an AMD display controller.
+    /// \param devicesFd the PCI device directory
+    /// \param name the name of the device's directory, which is its PCI address
+    /// \param[out] gpu the device, without its card
+    /// \return true if the device is an AMD display controller
+    bool ReadAmdGpu(int devicesFd, const char *name, AMDTDeviceInfoUtils::PciGpu &gpu)
+    {
+        const FileDescriptor device(openat(devicesFd, name, O_RDONLY | O_DIRECTORY | O_CLOEXEC));
+        if (device.Get() < 0)
+        {
+            return false;
+        }
+
+        // Read the attributes that rule out most devices first.
+        const std::optional<uint32_t> pciClass = ReadHexAttribute(device.Get(), "class");
+        if (!pciClass.has_value() || (*pciClass >> 16) != kDisplayControllerClass)
+        {
+            return false;
+        }
+
+        const std::optional<uint32_t> vendorID = ReadHexAttribute(device.Get(), "vendor");
+        if (vendorID != AMDTDeviceInfoUtils::kAmdVendorId)
+        {
+            return false;
+        }
+
+        const std::optional<uint32_t> deviceID   = ReadHexAttribute(device.Get(), "device");
+        const std::optional<uint32_t> revisionID = ReadHexAttribute(device.Get(), "revision");
+        if (!deviceID.has_value() || !revisionID.has_value())
+        {
+            return false;
+        }
+
+        gpu.pciAddress = name;
+        gpu.vendorID   = *vendorID;
+        gpu.deviceID   = *deviceID;
+        gpu.revisionID = *revisionID;
+        return true;
+    }
+} // namespace
+
+AMDTDeviceInfoUtils::SysfsGpuEnumerator::SysfsGpuEnumerator(std::string sysfsRoot)
+    : m_devicesPath(std::move(sysfsRoot) + "/bus/pci/devices")
+{
+}
+
+std::span<const AMDTDeviceInfoUtils::PciGpu> AMDTDeviceInfoUtils::SysfsGpuEnumerator::Enumerate()
+{
+    FileDescriptor devices(open(m_devicesPath.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC));
+    struct stat    devicesStat = {};
+    if (devices.Get() < 0 || fstat(devices.Get(), &devicesStat) != 0)
+    {
+        m_gpus.clear();
+        m_devicesMtime.reset();
+        return {};
+    }
+
+    if (m_devicesMtime.has_value() && m_devicesMtime->tv_sec == devicesStat.st_mtim.tv_sec && m_devicesMtime->tv_nsec == devicesStat.st_mtim.tv_nsec)
+    {
+        return m_gpus;
+    }
+
+    m_gpus.clear();
+    m_devicesMtime.reset();
+
+    // Keep a descriptor for openat, since closedir closes the one handed to fdopendir.
+    const FileDescriptor devicesFd(dup(devices.Get()));
+    DIR                 *directory = (devicesFd.Get() >= 0) ? fdopendir(devices.Get()) : nullptr;
+    if (nullptr == directory)
+    {
+        return {};
+    }
+
+    // The directory stream owns the descriptor only once fdopendir succeeded.
+    static_cast<void>(devices.Release());
+
+    PciGpu gpu;
+    while (const dirent *entry = readdir(directory))
+    {
+        if (entry->d_name[0] != '.' && ReadAmdGpu(devicesFd.Get(), entry->d_name, gpu))
+        {
+            m_gpus.push_back(std::move(gpu));
+            gpu = {};
+        }
+    }
+    closedir(directory);
+
+    std::ranges::sort(m_gpus, {}, &PciGpu::pciAddress);
+
+    // Resolve every GPU in one pass over the device ID index once the directory has been read.
+    for (PciGpu &found : m_gpus)
+    {
+        for (CardHandle card : FindCardsByDeviceId(found.deviceID))
+        {
+            if (gs_cardInfo[card].m_revID == found.revisionID)
+            {
+                found.card = card;
+                break;
+            }
+        }
+    }
+
+    m_devicesMtime = devicesStat.st_mtim;
+    return m_gpus;
+}
@@ -0,0 +1,53 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Enumeration of the local AMD GPUs through Linux sysfs.
+//==============================================================================
+
+#ifndef DEVICE_INFO_DEVICE_INFO_SYSFS_H_
+#define DEVICE_INFO_DEVICE_INFO_SYSFS_H_
+
+#include <cstdint>
+#include <ctime>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "DeviceInfoQuery.h"
+
+namespace AMDTDeviceInfoUtils
+{
+    /// An AMD display-class device found on the PCI bus.
+    struct PciGpu
+    {
+        std::string               pciAddress;     ///< PCI address, e.g. "0000:03:00.0".
+        uint32_t                  vendorID   = 0; ///< PCI vendor ID.
+        uint32_t                  deviceID   = 0; ///< PCI device ID.
+        uint32_t                  revisionID = 0; ///< PCI revision ID.
+        std::optional<CardHandle> card;           ///< The card with the device ID and revision ID, std::nullopt if it is not in the card info table.
+    };
+
+    /// Enumerates the AMD GPUs in /sys/bus/pci/devices. Only available on Linux.
+    /// The attributes of every device are read with openat relative to the device directory, and the result is cached until the
+    /// modification time of the PCI device directory changes, so polling is cheap. An enumerator is not thread safe.
+    class SysfsGpuEnumerator
+    {
+    public:
+        /// Constructor
+        /// \param sysfsRoot the directory sysfs is mounted at, e.g. the root of a fake directory tree for testing
+        explicit SysfsGpuEnumerator(std::string sysfsRoot = "/sys");
+
+        /// Enumerate the AMD GPUs, reusing the previous result if the PCI device directory did not change since.
+        /// \return the GPUs ordered by PCI address, valid until the next call; empty if the PCI device directory cannot be read
+        [[nodiscard]] std::span<const PciGpu> Enumerate();
+
+    private:
+        std::string             m_devicesPath;  ///< Path of the PCI device directory.
+        std::vector<PciGpu>     m_gpus;         ///< The GPUs found by the last enumeration.
+        std::optional<timespec> m_devicesMtime; ///< Modification time of the PCI device directory at the last enumeration, if any.
+    };
+} // namespace AMDTDeviceInfoUtils
+
+#endif
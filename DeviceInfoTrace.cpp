@@ -0,0 +1,104 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Recording of the lookups made by a process, for replaying them in benchmarks.
+//==============================================================================
+
+#include "DeviceInfoTrace.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+
+#include "DeviceInfoTraceRecorder.h"
+
+namespace
+{
+    static_assert(sizeof(AMDTDeviceInfoUtils::LookupTraceRecord) == 16, "The trace record layout is part of the trace file format.");
+
+    std::mutex gs_lookupTraceMutex;          ///< Serializes the writers of gs_lookupTraceFile.
+    FILE      *gs_lookupTraceFile = nullptr; ///< The trace being recorded, nullptr if there is none.
+
+    /// Close the trace being recorded. The caller needs to hold gs_lookupTraceMutex.
+    void CloseLookupTrace()
+    {
+        AMDTDeviceInfoUtils::Internal::gs_lookupTraceActive.store(false, std::memory_order_relaxed);
+        if (nullptr != gs_lookupTraceFile)
+        {
+            std::fclose(gs_lookupTraceFile);
+            gs_lookupTraceFile = nullptr;
+        }
+    }
+} // namespace
+
+void AMDTDeviceInfoUtils::Internal::WriteLookupTraceRecord(LookupTraceApi api, uint32_t vendorID, uint32_t deviceID, uint32_t revisionID, std::string_view name)
+{
+    const LookupTraceRecord record = {api, static_cast<uint8_t>(std::min<size_t>(name.size(), UINT8_MAX)), 0, vendorID, deviceID, revisionID};
+
+    std::lock_guard<std::mutex> lock(gs_lookupTraceMutex);
+    if (nullptr != gs_lookupTraceFile)
+    {
+        std::fwrite(&record, sizeof(record), 1, gs_lookupTraceFile);
+        std::fwrite(name.data(), 1, record.nameLength, gs_lookupTraceFile);
+    }
+}
+
+bool AMDTDeviceInfoUtils::StartLookupTrace(const char *path)
+{
+#ifdef DEVICE_INFO_TRACE_LOOKUPS
+    std::lock_guard<std::mutex> lock(gs_lookupTraceMutex);
+    CloseLookupTrace();
+
+    gs_lookupTraceFile = std::fopen(path, "wb");
+    if (nullptr == gs_lookupTraceFile)
+    {
+        return false;
+    }
+
+    std::fwrite(kLookupTraceMagic.data(), 1, kLookupTraceMagic.size(), gs_lookupTraceFile);
+    Internal::gs_lookupTraceActive.store(true, std::memory_order_relaxed);
+    return true;
+#else
+    static_cast<void>(path);
+    return false;
+#endif
+}
+
+void AMDTDeviceInfoUtils::StopLookupTrace()
+{
+    std::lock_guard<std::mutex> lock(gs_lookupTraceMutex);
+    CloseLookupTrace();
+}
+
+bool AMDTDeviceInfoUtils::ReadLookupTrace(std::span<const char> trace, std::vector<LookupTraceEntry> &entries)
+{
+    entries.clear();
+
+    if (trace.size() < kLookupTraceMagic.size() || std::string_view(trace.data(), kLookupTraceMagic.size()) != kLookupTraceMagic)
+    {
+        return false;
+    }
+
+    for (size_t offset = kLookupTraceMagic.size(); offset < trace.size();)
+    {
+        LookupTraceRecord record;
+        if (trace.size() - offset < sizeof(record))
+        {
+            return false;
+        }
+        std::memcpy(&record, trace.data() + offset, sizeof(record));
+        offset += sizeof(record);
+
+        if (record.api < LookupTraceApi::kDeviceId || record.api > LookupTraceApi::kResolveDeviceNames || trace.size() - offset < record.nameLength)
+        {
+            return false;
+        }
+
+        entries.push_back({record.api, record.vendorID, record.deviceID, record.revisionID, std::string_view(trace.data() + offset, record.nameLength)});
+        offset += record.nameLength;
+    }
+
+    return true;
+}
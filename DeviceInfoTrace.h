@@ -0,0 +1,73 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Recording of the lookups made by a process, for replaying them in benchmarks.
+//==============================================================================
+
+#ifndef DEVICE_INFO_DEVICE_INFO_TRACE_H_
+#define DEVICE_INFO_DEVICE_INFO_TRACE_H_
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace AMDTDeviceInfoUtils
+{
+    /// The lookup API a trace record was made by.
+    enum class LookupTraceApi : uint8_t
+    {
+        kDeviceId           = 1, ///< A lookup by vendor ID, device ID and revision ID, e.g. GetDeviceInfo, IsAPU or GetHardwareGeneration.
+        kCalName            = 2, ///< A lookup by CAL name, e.g. GetDeviceInfo, IsAPU or GetHardwareGeneration.
+        kMarketingName      = 3, ///< A lookup by marketing name, i.e. FindCardsByMarketingName or GetDeviceInfoMarketingName.
+        kResolveDevices     = 4, ///< A device resolved by ResolveDevices; consecutive records of one call form its batch.
+        kResolveDeviceNames = 5, ///< A name resolved by ResolveDeviceNames; consecutive records of one call form its batch.
+    };
+
+    /// The fixed-size part of a trace record, in host byte order. It is followed by nameLength bytes of name.
+    struct LookupTraceRecord
+    {
+        LookupTraceApi api;        ///< The lookup API.
+        uint8_t        nameLength; ///< Length of the name that follows the record; names are truncated to 255 bytes.
+        uint16_t       reserved;   ///< Zero.
+        uint32_t       vendorID;   ///< PCI vendor ID, for device ID lookups.
+        uint32_t       deviceID;   ///< Device ID, for device ID lookups.
+        uint32_t       revisionID; ///< Revision ID, for device ID lookups.
+    };
+
+    /// The bytes a trace file starts with.
+    inline constexpr std::string_view kLookupTraceMagic = "DITRACE1";
+
+    /// A lookup read from a trace.
+    struct LookupTraceEntry
+    {
+        LookupTraceApi   api        = LookupTraceApi::kDeviceId; ///< The lookup API.
+        uint32_t         vendorID   = 0;                         ///< PCI vendor ID, for device ID lookups.
+        uint32_t         deviceID   = 0;                         ///< Device ID, for device ID lookups.
+        uint32_t         revisionID = 0;                         ///< Revision ID, for device ID lookups.
+        std::string_view name;                                   ///< The name, for name lookups; a view into the trace.
+    };
+
+    /// Start recording every lookup to a trace file, replacing any trace being recorded.
+    /// Every lookup by device ID, CAL name or marketing name is recorded once, whichever overload made it, including the ones that
+    /// fill a std::vector, such as GetAllCardsWithName and GetAllCardsWithDeviceId; ResolveDevices and ResolveDeviceNames record
+    /// one entry per device or name. FindCardsByDeviceId, FindCardsByCalName and FindCardsByGfxTarget, the card set queries,
+    /// GetAllCardsInHardwareGeneration and GetAllCardsWithAsicType are not recorded.
+    /// Recording is only available when the library is built with DEVICE_INFO_TRACE_LOOKUPS, which adds a load of a flag
+    /// to every lookup; while recording, every lookup also takes a lock to append its record to the file.
+    /// \param[in] path the path of the trace file
+    /// \return false if the library is built without DEVICE_INFO_TRACE_LOOKUPS or the file cannot be created
+    bool StartLookupTrace(const char *path);
+
+    /// Stop recording lookups and close the trace file.
+    void StopLookupTrace();
+
+    /// Read the lookups of a trace.
+    /// \param[in] trace the contents of a trace file
+    /// \param[out] entries the lookups, in the order they were recorded; their names point into trace
+    /// \return false if trace is not a complete trace file
+    [[nodiscard]] bool ReadLookupTrace(std::span<const char> trace, std::vector<LookupTraceEntry> &entries);
+} // namespace AMDTDeviceInfoUtils
+
+#endif
@@ -0,0 +1,56 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Hooks that record lookups into the trace started with StartLookupTrace.
+//==============================================================================
+
+#ifndef DEVICE_INFO_DEVICE_INFO_TRACE_RECORDER_H_
+#define DEVICE_INFO_DEVICE_INFO_TRACE_RECORDER_H_
+
+#include <atomic>
+#include <cstdint>
+#include <string_view>
+
+#include "DeviceInfoTrace.h"
+
+namespace AMDTDeviceInfoUtils::Internal
+{
+    /// Whether a trace is being recorded.
+    inline std::atomic<bool> gs_lookupTraceActive = false;
+
+    /// Append a record to the trace, if one is being recorded.
+    void WriteLookupTraceRecord(LookupTraceApi api, uint32_t vendorID, uint32_t deviceID, uint32_t revisionID, std::string_view name);
+
+    /// Record a lookup by device ID. Does nothing without DEVICE_INFO_TRACE_LOOKUPS.
+    inline void TraceLookup(LookupTraceApi api, uint32_t vendorID, uint32_t deviceID, uint32_t revisionID)
+    {
+#ifdef DEVICE_INFO_TRACE_LOOKUPS
+        if (gs_lookupTraceActive.load(std::memory_order_relaxed))
+        {
+            WriteLookupTraceRecord(api, vendorID, deviceID, revisionID, {});
+        }
+#else
+        static_cast<void>(api);
+        static_cast<void>(vendorID);
+        static_cast<void>(deviceID);
+        static_cast<void>(revisionID);
+#endif
+    }
+
+    /// Record a lookup by name. Does nothing without DEVICE_INFO_TRACE_LOOKUPS.
+    inline void TraceLookup(LookupTraceApi api, std::string_view name)
+    {
+#ifdef DEVICE_INFO_TRACE_LOOKUPS
+        if (gs_lookupTraceActive.load(std::memory_order_relaxed))
+        {
+            WriteLookupTraceRecord(api, 0, 0, 0, name);
+        }
+#else
+        static_cast<void>(api);
+        static_cast<void>(name);
+#endif
+    }
+} // namespace AMDTDeviceInfoUtils::Internal
+
+#endif
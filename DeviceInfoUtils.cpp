@@ -6,36 +6,269 @@
 //==============================================================================
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cassert>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <string_view>
 #include <ranges>
+#include <vector>
 
 #include "DeviceInfoUtils.h"
+#include "DeviceInfoGfxTarget.h"
+#include "DeviceInfoIndex.h"
+#include "DeviceInfoLookupCache.h"
+#include "DeviceInfoMissRecorder.h"
+#include "DeviceInfoNameIndex.h"
+#include "DeviceInfoNameLookup.h"
+#include "DeviceInfoOverride.h"
+#include "DeviceInfoTraceRecorder.h"
+#include "DeviceInfoVendor.h"
 
 namespace
 {
-    AMDTDeviceInfoUtils::DeviceNameTranslatorFunction deviceNameTranslatorFunction = nullptr; ///< The function to call to translate device names.
+    /// An installed device name translator. Exactly one of the functions is set.
+    struct DeviceNameTranslator
+    {
+        AMDTDeviceInfoUtils::DeviceNameTranslatorFunction     function     = nullptr; ///< The function to call to translate device names.
+        AMDTDeviceInfoUtils::DeviceNameViewTranslatorFunction viewFunction = nullptr; ///< The non-allocating function to call to translate device names.
+    };
 
-    constexpr unsigned int kGfxToGdtHwGenConversionFactor = 3; ///< Factor to apply when converting between GFX IP version and GDT_HW_GENERATION.
-}
+    std::atomic<const DeviceNameTranslator *> gs_deviceNameTranslator = nullptr; ///< The installed translator, nullptr if there is none.
 
-bool AMDTDeviceInfoUtils::GetDeviceInfo(uint32_t deviceID, uint32_t revisionID, GDT_DeviceInfo &deviceInfo)
-{
-    auto find_device = [&](GDT_GfxCardInfo const &info)
+    std::mutex                                         gs_deviceNameTranslatorMutex; ///< Serializes the writers of gs_deviceNameTranslator.
+    std::vector<std::unique_ptr<DeviceNameTranslator>> gs_deviceNameTranslators;     ///< Every installed translator, kept alive since readers do not lock.
+
+    /// Install a device name translator, replacing the installed one. Lookups may run concurrently with this function.
+    /// \param function the function to use to translate device names, or nullptr
+    /// \param viewFunction the non-allocating function to use to translate device names, or nullptr
+    void InstallDeviceNameTranslator(AMDTDeviceInfoUtils::DeviceNameTranslatorFunction function, AMDTDeviceInfoUtils::DeviceNameViewTranslatorFunction viewFunction)
     {
-        if (info.m_deviceID != deviceID)
+        std::lock_guard<std::mutex> lock(gs_deviceNameTranslatorMutex);
+
+        const DeviceNameTranslator *translator = nullptr;
+        if (nullptr != function || nullptr != viewFunction)
         {
-            return false;
+            // Reuse the translator if it was installed before, so switching between translators does not allocate every time.
+            auto same_functions = [&](const std::unique_ptr<DeviceNameTranslator> &installed)
+            { return installed->function == function && installed->viewFunction == viewFunction; };
+
+            const auto it = std::ranges::find_if(gs_deviceNameTranslators, same_functions);
+            if (it != gs_deviceNameTranslators.end())
+            {
+                translator = it->get();
+            }
+            else
+            {
+                gs_deviceNameTranslators.push_back(std::make_unique<DeviceNameTranslator>(DeviceNameTranslator{function, viewFunction}));
+                translator = gs_deviceNameTranslators.back().get();
+            }
         }
 
-        return (kRevisionIdAny == revisionID || info.m_revID == revisionID);
+        gs_deviceNameTranslator.store(translator, std::memory_order_release);
+        AMDTDeviceInfoUtils::Internal::InvalidateLookupCaches();
+    }
+
+    /// Device names that some drivers report instead of the name in the device info table.
+    struct DeviceNameAlias
+    {
+        std::string_view reportedName; ///< The name reported by the driver.
+        std::string_view tableName;    ///< The name in the device info table.
     };
 
-    const auto it = std::ranges::find_if(gs_cardInfo, find_device);
-    const bool found = it != gs_cardInfo.end();
+    constexpr DeviceNameAlias kDeviceNameAliases[] = {
+        {"gfx901", "gfx900"}, // some gfx900 boards are identified as gfx901 by some drivers
+        {"gfx903", "gfx902"}, // some gfx902 APUs are identified as gfx903 by some drivers
+        {"gfx905", "gfx904"}, // some gfx904 boards are identified as gfx905
+        {"gfx907", "gfx906"}, // some gfx906 boards are identified as gfx907
+    };
+
+    /// A device name alias between gfx target names, as gfx target keys.
+    struct GfxTargetAlias
+    {
+        AMDTDeviceInfoUtils::GfxTargetKey reportedTarget; ///< The gfx target reported by the driver.
+        AMDTDeviceInfoUtils::GfxTargetKey tableTarget;    ///< The gfx target in the device info table.
+    };
+
+    consteval std::array<GfxTargetAlias, std::size(kDeviceNameAliases)> GfxTargetAliases()
+    {
+        std::array<GfxTargetAlias, std::size(kDeviceNameAliases)> aliases{};
+        for (size_t i = 0; i < aliases.size(); ++i)
+        {
+            aliases[i] = {AMDTDeviceInfoUtils::ParseGfxTarget(kDeviceNameAliases[i].reportedName).value(),
+                          AMDTDeviceInfoUtils::ParseGfxTarget(kDeviceNameAliases[i].tableName).value()};
+        }
+        return aliases;
+    }
+
+    constexpr auto kGfxTargetAliases = GfxTargetAliases(); ///< kDeviceNameAliases as gfx target keys.
+
+    /// Translate a device name with a translator, see AMDTDeviceInfoUtils::TranslateDeviceName.
+    /// \param translator the installed translator, nullptr if there is none
+    /// \param deviceName the device name to translate
+    /// \param storage storage for a name translated by a translator installed with SetDeviceNameTranslator
+    /// \return the translated name
+    std::string_view TranslateDeviceNameWith(const DeviceNameTranslator *translator, std::string_view deviceName, std::string &storage)
+    {
+        std::string_view retVal = deviceName;
+
+        auto same_name = [&retVal](const DeviceNameAlias &alias)
+        { return retVal == alias.reportedName; };
+
+        const auto alias = std::ranges::find_if(kDeviceNameAliases, same_name);
+        if (alias != std::ranges::end(kDeviceNameAliases))
+        {
+            retVal = alias->tableName;
+        }
+
+        if (nullptr != translator && nullptr != translator->viewFunction)
+        {
+            retVal = translator->viewFunction(retVal);
+        }
+        else if (nullptr != translator)
+        {
+            // The legacy translator needs a NUL terminated string.
+            storage.assign(retVal);
+            storage = translator->function(storage.c_str());
+            retVal  = storage;
+        }
+
+        return retVal;
+    }
+
+    using DeviceIdCache = AMDTDeviceInfoUtils::Internal::LookupCache<AMDTDeviceInfoUtils::Internal::DeviceLookupKey, AMDTDeviceInfoUtils::ResolvedDevice>;
+    using CalNameCache  = AMDTDeviceInfoUtils::Internal::LookupCache<AMDTDeviceInfoUtils::Internal::NameLookupKey, const GDT_GfxCardInfo *>;
+
+    constinit thread_local DeviceIdCache gs_deviceIdCache; ///< The last device ID lookups of this thread.
+    constinit thread_local CalNameCache  gs_calNameCache;  ///< The last CAL name lookups of this thread.
+
+    /// Find the first card with a device ID and revision ID.
+    /// \param deviceID the device ID
+    /// \param revisionID the revision ID, kRevisionIdAny for any revision
+    /// \return the card and its device info including any override, both nullptr if there is no such card
+    AMDTDeviceInfoUtils::ResolvedDevice FindCardWithDeviceId(uint32_t deviceID, uint32_t revisionID)
+    {
+        AMDTDeviceInfoUtils::Internal::TraceLookup(AMDTDeviceInfoUtils::LookupTraceApi::kDeviceId, AMDTDeviceInfoUtils::kAmdVendorId, deviceID, revisionID);
+
+        auto find_card = [&]() -> AMDTDeviceInfoUtils::ResolvedDevice
+        {
+            for (AMDTDeviceInfoUtils::CardHandle card : AMDTDeviceInfoUtils::FindCardsByDeviceId(deviceID))
+            {
+                if (AMDTDeviceInfoUtils::kRevisionIdAny == revisionID || gs_cardInfo[card].m_revID == revisionID)
+                {
+                    return {&gs_cardInfo[card], &AMDTDeviceInfoUtils::GetCardDeviceInfo(card)};
+                }
+            }
+
+            return {};
+        };
+
+        const AMDTDeviceInfoUtils::ResolvedDevice card = gs_deviceIdCache.Get({AMDTDeviceInfoUtils::kAmdVendorId, deviceID, revisionID}, find_card);
+        if (nullptr == card.cardInfo)
+        {
+            AMDTDeviceInfoUtils::Internal::RecordLookupMiss(AMDTDeviceInfoUtils::LookupTraceApi::kDeviceId, AMDTDeviceInfoUtils::kAmdVendorId, deviceID, revisionID);
+        }
+        return card;
+    }
+
+    /// Find the cards with a CAL name, without consulting the lookup cache.
+    /// Without a device name translator, gfx target names are looked up by their numeric key; other names are looked up by their hash.
+    /// \param calDeviceName the CAL name, which is translated with translator
+    /// \param hash the HashString hash of calDeviceName
+    /// \param translator the installed translator, nullptr if there is none
+    /// \param storage storage for a name translated by a translator installed with SetDeviceNameTranslator
+    /// \return the cards in table order, empty if there is none with the name
+    std::span<const AMDTDeviceInfoUtils::CardHandle> LookUpCardsWithCalName(std::string_view            calDeviceName,
+                                                                            uint64_t                    hash,
+                                                                            const DeviceNameTranslator *translator,
+                                                                            std::string                &storage)
+    {
+        if (nullptr == translator)
+        {
+            if (auto target = AMDTDeviceInfoUtils::ParseGfxTarget(calDeviceName); target.has_value())
+            {
+                for (const GfxTargetAlias &alias : kGfxTargetAliases)
+                {
+                    if (*target == alias.reportedTarget)
+                    {
+                        target = alias.tableTarget;
+                        break;
+                    }
+                }
+
+                return AMDTDeviceInfoUtils::FindCardsByGfxTarget(*target);
+            }
+        }
+
+        const std::string_view deviceName = TranslateDeviceNameWith(translator, calDeviceName, storage);
+
+        // Most names are not translated, and those do not need to be hashed again.
+        const bool isUntranslated = deviceName.data() == calDeviceName.data() && deviceName.size() == calDeviceName.size();
+        return AMDTDeviceInfoUtils::Internal::LookUpCardsByCalName(deviceName, isUntranslated ? hash : AMDTDeviceInfoUtils::Internal::HashString(deviceName));
+    }
+
+    /// Find the first card with a CAL name.
+    /// \param calDeviceName the CAL name, which is translated with TranslateDeviceName
+    /// \return the card, or nullptr if there is none with the name
+    const GDT_GfxCardInfo *FindCardWithCalName(std::string_view calDeviceName)
+    {
+        AMDTDeviceInfoUtils::Internal::TraceLookup(AMDTDeviceInfoUtils::LookupTraceApi::kCalName, calDeviceName);
+
+        auto find_card = [calDeviceName]() -> const GDT_GfxCardInfo *
+        {
+            std::string                                            storage;
+            const std::span<const AMDTDeviceInfoUtils::CardHandle> cards = LookUpCardsWithCalName(
+                calDeviceName, AMDTDeviceInfoUtils::Internal::HashString(calDeviceName), gs_deviceNameTranslator.load(std::memory_order_acquire), storage);
+            return cards.empty() ? nullptr : &gs_cardInfo[cards.front()];
+        };
+
+        const std::optional<AMDTDeviceInfoUtils::Internal::NameLookupKey> key  = AMDTDeviceInfoUtils::Internal::NameLookupKey::Make(calDeviceName);
+        const GDT_GfxCardInfo                                            *card = key.has_value() ? gs_calNameCache.Get(*key, find_card) : find_card();
+        if (nullptr == card)
+        {
+            AMDTDeviceInfoUtils::Internal::RecordLookupMiss(AMDTDeviceInfoUtils::LookupTraceApi::kCalName, calDeviceName);
+        }
+        return card;
+    }
+
+    /// Look up a name of a ResolveDeviceNames batch, first as a CAL name and then as a marketing name.
+    /// \param name the name
+    /// \param hash the HashString hash of name
+    /// \param translator the installed translator, nullptr if there is none
+    /// \param storage storage for a name translated by a translator installed with SetDeviceNameTranslator
+    /// \return the result of the lookup
+    AMDTDeviceInfoUtils::ResolvedDeviceName ResolveDeviceName(std::string_view name, uint64_t hash, const DeviceNameTranslator *translator, std::string &storage)
+    {
+        AMDTDeviceInfoUtils::ResolvedDeviceName result;
+        result.cards = LookUpCardsWithCalName(name, hash, translator, storage);
+        result.match = AMDTDeviceInfoUtils::DeviceNameMatch::kCalName;
+        if (result.cards.empty())
+        {
+            result.cards = AMDTDeviceInfoUtils::Internal::LookUpCardsByMarketingName(name);
+            result.match = AMDTDeviceInfoUtils::DeviceNameMatch::kMarketingName;
+        }
+        if (result.cards.empty())
+        {
+            return {};
+        }
+
+        const GDT_GfxCardInfo &card = gs_cardInfo[result.cards.front()];
+        result.deviceInfo           = &AMDTDeviceInfoUtils::GetCardDeviceInfo(result.cards.front());
+        result.generation           = card.m_generation;
+        result.isAPU                = card.m_bAPU;
+        return result;
+    }
+}
+
+bool AMDTDeviceInfoUtils::GetDeviceInfo(uint32_t deviceID, uint32_t revisionID, GDT_DeviceInfo &deviceInfo)
+{
+    const ResolvedDevice card  = FindCardWithDeviceId(deviceID, revisionID);
+    const bool           found = nullptr != card.cardInfo;
     if (found)
     {
-        deviceInfo = GetDeviceInfoForAsicType(it->m_asicType);
+        deviceInfo = *card.deviceInfo;
     }
     return found;
 }
@@ -43,16 +276,17 @@ bool AMDTDeviceInfoUtils::GetDeviceInfo(uint32_t deviceID, uint32_t revisionID,
 /// NOTE: this might not return the correct GDT_DeviceInfo instance, since some devices with the same CAL name might have different GDT_DeviceInfo instances
 bool AMDTDeviceInfoUtils::GetDeviceInfo(const char *szCALDeviceName, GDT_DeviceInfo &deviceInfo)
 {
-    const std::string strDeviceName = TranslateDeviceName(szCALDeviceName);
-
-    auto same_name = [&strDeviceName](GDT_GfxCardInfo const &info)
-    { return strDeviceName == info.m_szCALName; };
+    return GetDeviceInfo(std::string_view(szCALDeviceName), deviceInfo);
+}
 
-    const auto it = std::ranges::find_if(gs_cardInfo, same_name);
-    const bool found = it != gs_cardInfo.end();
+bool AMDTDeviceInfoUtils::GetDeviceInfo(std::string_view calDeviceName, GDT_DeviceInfo &deviceInfo)
+{
+    const GDT_GfxCardInfo *card  = FindCardWithCalName(calDeviceName);
+    const bool             found = nullptr != card;
     if (found)
     {
-        deviceInfo = GetDeviceInfoForAsicType(it->m_asicType);
+        // Return the overridden device info of the card, like GetDeviceInfo by device ID and ResolveDeviceNames do.
+        deviceInfo = GetCardDeviceInfo(static_cast<CardHandle>(card - gs_cardInfo.data()));
     }
     return found;
 }
@@ -84,73 +318,89 @@ bool AMDTDeviceInfoUtils::GetDeviceInfo(const char *szCALDeviceName, GDT_DeviceI
 
 bool AMDTDeviceInfoUtils::GetDeviceInfo(uint32_t deviceID, uint32_t revisionID, GDT_GfxCardInfo &cardInfo)
 {
-    auto find_device = [&](GDT_GfxCardInfo const &info)
-    {
-        if (info.m_deviceID != deviceID)
-        {
-            return false;
-        }
-
-        return (kRevisionIdAny == revisionID || info.m_revID == revisionID);
-    };
-
-    const auto it = std::ranges::find_if(gs_cardInfo, find_device);
-    const bool found = it != gs_cardInfo.end();
+    const ResolvedDevice card  = FindCardWithDeviceId(deviceID, revisionID);
+    const bool           found = nullptr != card.cardInfo;
     if (found)
     {
-        cardInfo = *it;
+        cardInfo = *card.cardInfo;
     }
     return found;
 }
 
 bool AMDTDeviceInfoUtils::GetDeviceInfo(const char *szCALDeviceName, std::vector<GDT_GfxCardInfo> &cardList)
 {
+    return GetDeviceInfo(std::string_view(szCALDeviceName), cardList);
+}
+
+bool AMDTDeviceInfoUtils::GetDeviceInfo(std::string_view calDeviceName, std::vector<GDT_GfxCardInfo> &cardList)
+{
+    Internal::TraceLookup(LookupTraceApi::kCalName, calDeviceName);
+
     cardList.clear();
 
-    const std::string strDeviceName = TranslateDeviceName(szCALDeviceName);
+    std::string            storage;
+    const std::string_view deviceName = TranslateDeviceName(calDeviceName, storage);
 
-    auto same_name = [&strDeviceName](GDT_GfxCardInfo const &info)
-    { return strDeviceName == info.m_szMarketingName; };
+    auto same_name = [&deviceName](GDT_GfxCardInfo const &info)
+    { return deviceName == info.m_szMarketingName; };
 
     std::ranges::copy_if(gs_cardInfo, std::back_inserter(cardList),
                          same_name);
 
+    if (cardList.empty())
+    {
+        Internal::RecordLookupMiss(LookupTraceApi::kCalName, calDeviceName);
+    }
     return !cardList.empty();
 }
 
 bool AMDTDeviceInfoUtils::GetDeviceInfoMarketingName(const char *szMarketingDeviceName, std::vector<GDT_GfxCardInfo> &cardList)
 {
-    cardList.clear();
-
-    const std::string_view marketing_name = szMarketingDeviceName;
+    return GetDeviceInfoMarketingName(std::string_view(szMarketingDeviceName), cardList);
+}
 
-    auto same_name = [&marketing_name](GDT_GfxCardInfo const &info)
-    { return marketing_name == info.m_szMarketingName; };
+bool AMDTDeviceInfoUtils::GetDeviceInfoMarketingName(std::string_view marketingDeviceName, std::vector<GDT_GfxCardInfo> &cardList)
+{
+    cardList.clear();
 
-    std::ranges::copy_if(gs_cardInfo, std::back_inserter(cardList),
-                         same_name);
+    // Exact matches are a subset of the matches after normalization, so only those cards need to be compared.
+    const std::span<const CardHandle> cards = FindCardsByMarketingName(marketingDeviceName);
+    for (CardHandle card : cards)
+    {
+        if (marketingDeviceName == gs_cardInfo[card].m_szMarketingName)
+        {
+            cardList.push_back(gs_cardInfo[card]);
+        }
+    }
 
+    // FindCardsByMarketingName records the miss if not even the normalized name matches.
+    if (cardList.empty() && !cards.empty())
+    {
+        Internal::RecordLookupMiss(LookupTraceApi::kMarketingName, marketingDeviceName);
+    }
     return !cardList.empty();
 }
 
 bool AMDTDeviceInfoUtils::IsAPU(const char *szCALDeviceName, bool &bIsAPU)
 {
-    const std::string strDeviceName = TranslateDeviceName(szCALDeviceName);
-
-    auto same_name = [&strDeviceName](GDT_GfxCardInfo const &info)
-    { return strDeviceName == info.m_szCALName; };
+    return IsAPU(std::string_view(szCALDeviceName), bIsAPU);
+}
 
-    const auto it = std::ranges::find_if(gs_cardInfo, same_name);
-    const bool found = it != gs_cardInfo.end();
+bool AMDTDeviceInfoUtils::IsAPU(std::string_view calDeviceName, bool &bIsAPU)
+{
+    const GDT_GfxCardInfo *card  = FindCardWithCalName(calDeviceName);
+    const bool             found = nullptr != card;
     if (found)
     {
-        bIsAPU = it->m_bAPU;
+        bIsAPU = card->m_bAPU;
     }
     return found;
 }
 
 bool AMDTDeviceInfoUtils::IsAPU(uint32_t deviceID, bool &isAPU)
 {
+    Internal::TraceLookup(LookupTraceApi::kDeviceId, kAmdVendorId, deviceID, kRevisionIdAny);
+
     auto find_device = [&](GDT_GfxCardInfo const &info)
     {
         return info.m_deviceID != deviceID;
@@ -162,6 +412,10 @@ bool AMDTDeviceInfoUtils::IsAPU(uint32_t deviceID, bool &isAPU)
     {
         isAPU = it->m_bAPU;
     }
+    else
+    {
+        Internal::RecordLookupMiss(LookupTraceApi::kDeviceId, kAmdVendorId, deviceID, kRevisionIdAny);
+    }
     return found;
 }
 
@@ -218,6 +472,8 @@ bool AMDTDeviceInfoUtils::IsSIFamily(uint32_t deviceID, bool &isSI)
 bool AMDTDeviceInfoUtils::GetHardwareGeneration(uint32_t deviceID, GDT_HW_GENERATION &gen)
 {
     // revId not needed here, since all revs will have the same hardware family
+    Internal::TraceLookup(LookupTraceApi::kDeviceId, kAmdVendorId, deviceID, kRevisionIdAny);
+
     auto find_device = [&](GDT_GfxCardInfo const &info)
     {
         return info.m_deviceID != deviceID;
@@ -229,22 +485,73 @@ bool AMDTDeviceInfoUtils::GetHardwareGeneration(uint32_t deviceID, GDT_HW_GENERA
     {
         gen = it->m_generation;
     }
+    else
+    {
+        Internal::RecordLookupMiss(LookupTraceApi::kDeviceId, kAmdVendorId, deviceID, kRevisionIdAny);
+    }
     return found;
 }
 
 bool AMDTDeviceInfoUtils::GetHardwareGeneration(const char *szCALDeviceName, GDT_HW_GENERATION &gen)
 {
-    const std::string strDeviceName = TranslateDeviceName(szCALDeviceName);
-
-    auto same_name = [&strDeviceName](GDT_GfxCardInfo const &info)
-    { return strDeviceName == info.m_szCALName; };
+    return GetHardwareGeneration(std::string_view(szCALDeviceName), gen);
+}
 
-    const auto it = std::ranges::find_if(gs_cardInfo, same_name);
-    const bool found = it != gs_cardInfo.end();
+bool AMDTDeviceInfoUtils::GetHardwareGeneration(std::string_view calDeviceName, GDT_HW_GENERATION &gen)
+{
+    const GDT_GfxCardInfo *card  = FindCardWithCalName(calDeviceName);
+    const bool             found = nullptr != card;
     if (found)
     {
-        gen = it->m_generation;
+        gen = card->m_generation;
+    }
+    return found;
+}
+
+size_t AMDTDeviceInfoUtils::ResolveDeviceNames(std::span<const std::string_view> names, std::span<ResolvedDeviceName> results)
+{
+    constexpr int    kRecentNameBits = 6;        // Log2 of the number of recently resolved names to look for repeats in.
+    constexpr size_t kNoRecentName   = SIZE_MAX; // Marks a recently resolved name slot as unused.
+
+    assert(results.size() >= names.size());
+
+    const DeviceNameTranslator *translator = gs_deviceNameTranslator.load(std::memory_order_acquire);
+    std::string                 storage;
+    size_t                      found = 0;
+
+    // The index of the last name resolved in each slot, so names repeated in the batch are only translated and looked up once.
+    std::array<size_t, size_t{1} << kRecentNameBits> recentNames;
+    recentNames.fill(kNoRecentName);
+
+    for (size_t i = 0; i < names.size(); ++i)
+    {
+        const std::string_view name   = names[i];
+        ResolvedDeviceName    &result = results[i];
+
+        Internal::TraceLookup(LookupTraceApi::kResolveDeviceNames, name);
+
+        const uint64_t hash   = Internal::HashString(name);
+        size_t        &recent = recentNames[Internal::HomeSlot(hash, kRecentNameBits)];
+        if (kNoRecentName != recent && names[recent] == name)
+        {
+            result = results[recent];
+        }
+        else
+        {
+            result = ResolveDeviceName(name, hash, translator, storage);
+            recent = i;
+        }
+
+        if (!result.cards.empty())
+        {
+            ++found;
+        }
+        else
+        {
+            Internal::RecordLookupMiss(LookupTraceApi::kResolveDeviceNames, name);
+        }
     }
+
     return found;
 }
 
@@ -260,6 +567,11 @@ bool AMDTDeviceInfoUtils::GetAllCardsWithName(const char *szCALDeviceName, std::
     return GetDeviceInfo(szCALDeviceName, cardList);
 }
 
+bool AMDTDeviceInfoUtils::GetAllCardsWithName(std::string_view calDeviceName, std::vector<GDT_GfxCardInfo> &cardList)
+{
+    return GetDeviceInfo(calDeviceName, cardList);
+}
+
 bool AMDTDeviceInfoUtils::GetAllCardsInHardwareGeneration(GDT_HW_GENERATION gen, std::vector<GDT_GfxCardInfo> &cardList)
 {
     cardList.clear();
@@ -275,14 +587,19 @@ bool AMDTDeviceInfoUtils::GetAllCardsInHardwareGeneration(GDT_HW_GENERATION gen,
 
 bool AMDTDeviceInfoUtils::GetAllCardsWithDeviceId(uint32_t deviceID, std::vector<GDT_GfxCardInfo> &cardList)
 {
-    cardList.clear();
+    Internal::TraceLookup(LookupTraceApi::kDeviceId, kAmdVendorId, deviceID, kRevisionIdAny);
 
-    auto same_device_id = [&deviceID](GDT_GfxCardInfo const &info)
-    { return deviceID == info.m_deviceID; };
+    cardList.clear();
 
-    std::ranges::copy_if(gs_cardInfo, std::back_inserter(cardList),
-                         same_device_id);
+    for (CardHandle card : FindCardsByDeviceId(deviceID))
+    {
+        cardList.push_back(gs_cardInfo[card]);
+    }
 
+    if (cardList.empty())
+    {
+        Internal::RecordLookupMiss(LookupTraceApi::kDeviceId, kAmdVendorId, deviceID, kRevisionIdAny);
+    }
     return !cardList.empty();
 }
 
@@ -299,144 +616,102 @@ bool AMDTDeviceInfoUtils::GetAllCardsWithAsicType(GDT_HW_ASIC_TYPE asicType, std
     return !cardList.empty();
 }
 
-bool AMDTDeviceInfoUtils::GetHardwareGenerationDisplayName(GDT_HW_GENERATION gen, std::string &strGenerationDisplayName)
+std::string_view AMDTDeviceInfoUtils::GetHardwareGenerationDisplayName(GDT_HW_GENERATION gen)
 {
-    static constexpr std::string_view s_SI_FAMILY_NAME    = "Graphics IP v6";
-    static constexpr std::string_view s_CI_FAMILY_NAME    = "Graphics IP v7";
-    static constexpr std::string_view s_VI_FAMILY_NAME    = "Graphics IP v8";
-    static constexpr std::string_view s_GFX9_FAMILY_NAME  = "Vega";
-    static constexpr std::string_view s_RDNA_FAMILY_NAME  = "RDNA";
-    static constexpr std::string_view s_RDNA2_FAMILY_NAME = "RDNA2";
-    static constexpr std::string_view s_RDNA3_FAMILY_NAME = "RDNA3";
-    static constexpr std::string_view s_RDNA4_FAMILY_NAME = "RDNA4";
-    static constexpr std::string_view s_CDNA_FAMILY_NAME  = "CDNA";
-    static constexpr std::string_view s_CDNA2_FAMILY_NAME = "CDNA2";
-    static constexpr std::string_view s_CDNA3_FAMILY_NAME = "CDNA3";
-    static constexpr std::string_view s_CDNA4_FAMILY_NAME = "CDNA4";
-
-    bool retVal = true;
-
     switch (gen)
     {
         case GDT_HW_GENERATION_SOUTHERNISLAND:
-            strGenerationDisplayName = s_SI_FAMILY_NAME;
-            break;
+            return "Graphics IP v6";
 
         case GDT_HW_GENERATION_SEAISLAND:
-            strGenerationDisplayName = s_CI_FAMILY_NAME;
-            break;
+            return "Graphics IP v7";
 
         case GDT_HW_GENERATION_VOLCANICISLAND:
-            strGenerationDisplayName = s_VI_FAMILY_NAME;
-            break;
+            return "Graphics IP v8";
 
         case GDT_HW_GENERATION_GFX9:
-            strGenerationDisplayName = s_GFX9_FAMILY_NAME;
-            break;
+            return "Vega";
 
         case GDT_HW_GENERATION_GFX10:
-            strGenerationDisplayName = s_RDNA_FAMILY_NAME;
-            break;
+            return "RDNA";
 
         case GDT_HW_GENERATION_GFX103:
-            strGenerationDisplayName = s_RDNA2_FAMILY_NAME;
-            break;
+            return "RDNA2";
 
         case GDT_HW_GENERATION_GFX11:
-            strGenerationDisplayName = s_RDNA3_FAMILY_NAME;
-            break;
+            return "RDNA3";
 
         case GDT_HW_GENERATION_GFX12:
-            strGenerationDisplayName = s_RDNA4_FAMILY_NAME;
-            break;
+            return "RDNA4";
 
         case GDT_HW_GENERATION_CDNA:
-            strGenerationDisplayName = s_CDNA_FAMILY_NAME;
-            break;
+            return "CDNA";
 
         case GDT_HW_GENERATION_CDNA2:
-            strGenerationDisplayName = s_CDNA2_FAMILY_NAME;
-            break;
+            return "CDNA2";
 
         case GDT_HW_GENERATION_CDNA3:
-            strGenerationDisplayName = s_CDNA3_FAMILY_NAME;
-            break;
+            return "CDNA3";
 
         case GDT_HW_GENERATION_CDNA4:
-            strGenerationDisplayName = s_CDNA4_FAMILY_NAME;
-            break;
+            return "CDNA4";
 
         default:
-            strGenerationDisplayName.clear();
-            assert(false);
-            retVal = false;
-            break;
+            return {};
     }
-
-    return retVal;
 }
 
-std::string AMDTDeviceInfoUtils::TranslateDeviceName(const char *strDeviceName)
+bool AMDTDeviceInfoUtils::GetHardwareGenerationDisplayName(GDT_HW_GENERATION gen, std::string &strGenerationDisplayName)
 {
-    std::string retVal(strDeviceName);
+    const std::string_view displayName = GetHardwareGenerationDisplayName(gen);
+    assert(!displayName.empty());
 
-    if (retVal.compare("gfx901") == 0) // some gfx900 boards are identified as gfx901 by some drivers
-    {
-        retVal = "gfx900";
-    }
-
-    if (retVal.compare("gfx903") == 0) // some gfx902 APUs are identified as gfx903 by some drivers
-    {
-        retVal = "gfx902";
-    }
-
-    if (retVal.compare("gfx905") == 0)  // some gfx904 boards are identified as gfx905
-    {
-        retVal = "gfx904";
-    }
-
-    if (retVal.compare("gfx907") == 0)  // some gfx906 boards are identified as gfx907
-    {
-        retVal = "gfx906";
-    }
+    strGenerationDisplayName = displayName;
+    return !displayName.empty();
+}
 
-    if (nullptr != deviceNameTranslatorFunction)
-    {
-        retVal = deviceNameTranslatorFunction(retVal.c_str());
-    }
+std::string AMDTDeviceInfoUtils::TranslateDeviceName(const char *strDeviceName)
+{
+    std::string storage;
+    return std::string(TranslateDeviceName(std::string_view(strDeviceName), storage));
+}
 
-    return retVal;
+std::string_view AMDTDeviceInfoUtils::TranslateDeviceName(std::string_view deviceName, std::string &storage)
+{
+    return TranslateDeviceNameWith(gs_deviceNameTranslator.load(std::memory_order_acquire), deviceName, storage);
 }
 
 bool AMDTDeviceInfoUtils::GfxIPVerToHwGeneration(uint32_t gfxIPVer, GDT_HW_GENERATION &hwGen)
 {
-    hwGen = static_cast<GDT_HW_GENERATION>(gfxIPVer - kGfxToGdtHwGenConversionFactor);
+    hwGen = GDT_HW_GENERATION_NONE;
 
-    bool retVal = hwGen >= GDT_HW_GENERATION_FIRST_AMD && hwGen < GDT_HW_GENERATION_LAST;
-
-    if (!retVal)
+    if (gfxIPVer <= kMaxGfxTargetMajor)
     {
-        hwGen = GDT_HW_GENERATION_NONE;
+        hwGen = GfxIpVersionToHwGeneration(MakeGfxTargetKey(gfxIPVer, 0, 0));
     }
 
-    return retVal;
+    return hwGen != GDT_HW_GENERATION_NONE;
 }
 
 bool AMDTDeviceInfoUtils::HwGenerationToGfxIPVer(GDT_HW_GENERATION hwGen, uint32_t &gfxIPVer)
 {
     gfxIPVer = 0;
 
-    bool retVal = hwGen >= GDT_HW_GENERATION_FIRST_AMD && hwGen < GDT_HW_GENERATION_LAST;
-
-    if (retVal)
+    const std::optional<GfxTargetKey> version = HwGenerationToGfxIpVersion(hwGen);
+    if (version.has_value())
     {
-        gfxIPVer = static_cast<uint32_t>(hwGen) + kGfxToGdtHwGenConversionFactor;
+        gfxIPVer = GfxTargetMajor(*version);
     }
 
-    return retVal;
+    return version.has_value();
 }
 
 void AMDTDeviceInfoUtils::SetDeviceNameTranslator(DeviceNameTranslatorFunction func)
 {
-    deviceNameTranslatorFunction = func;
+    InstallDeviceNameTranslator(func, nullptr);
+}
+
+void AMDTDeviceInfoUtils::SetDeviceNameViewTranslator(DeviceNameViewTranslatorFunction func)
+{
+    InstallDeviceNameTranslator(nullptr, func);
 }
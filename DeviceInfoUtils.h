@@ -10,6 +10,7 @@
 
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 #include "DeviceInfo.h"
 
@@ -23,24 +24,41 @@ namespace AMDTDeviceInfoUtils
     /// Function pointer type for a function that will translate device names
     using DeviceNameTranslatorFunction = std::string (*)(const char *strDeviceName);
 
-    /// Sets the Device name translator function
+    /// Function pointer type for a function that will translate device names without allocating.
+    /// The returned view must either point into the input or at storage that outlives every lookup, such as a string literal.
+    using DeviceNameViewTranslatorFunction = std::string_view (*)(std::string_view strDeviceName);
+
+    /// Sets the Device name translator function, replacing any previously installed translator
+    /// Lookups may run concurrently with this function; each lookup uses either the old or the new translator.
     /// \param func the function to use to translate device names
     void SetDeviceNameTranslator(DeviceNameTranslatorFunction func);
 
-    /// Get device info from device ID
+    /// Sets the non-allocating Device name translator function, replacing any previously installed translator
+    /// Lookups may run concurrently with this function; each lookup uses either the old or the new translator.
+    /// \param func the function to use to translate device names
+    void SetDeviceNameViewTranslator(DeviceNameViewTranslatorFunction func);
+
+    /// Get device info from device ID, including any override registered with SetDeviceInfoOverrides
     /// \param[in] deviceID Device ID
     /// \param[in] revisionID RevisionID, pass kRevisionIdAny if revision ID is not important.
     /// \param[out] deviceInfo Output device info if device id is found.
     /// \return True if device info is found
     [[nodiscard]] bool GetDeviceInfo(uint32_t deviceID, uint32_t revisionID, GDT_DeviceInfo &deviceInfo);
 
-    /// Get device info from CAL name string
+    /// Get device info from CAL name string, including any override registered with SetDeviceInfoOverrides for the first card with the name
     /// NOTE: this might not return the correct GDT_DeviceInfo instance, since some devices with the same CAL name might have different GDT_DeviceInfo instances
     /// \param[in] szCALDeviceName CAL device name string
     /// \param[out] deviceInfo Output device info if device id is found.
     /// \return True if device info is found
     [[nodiscard]] bool GetDeviceInfo(const char *szCALDeviceName, GDT_DeviceInfo &deviceInfo);
 
+    /// Get device info from CAL name string, including any override registered with SetDeviceInfoOverrides for the first card with the name
+    /// NOTE: this might not return the correct GDT_DeviceInfo instance, since some devices with the same CAL name might have different GDT_DeviceInfo instances
+    /// \param[in] calDeviceName CAL device name string, which does not need to be NUL terminated
+    /// \param[out] deviceInfo Output device info if device id is found.
+    /// \return True if device info is found
+    [[nodiscard]] bool GetDeviceInfo(std::string_view calDeviceName, GDT_DeviceInfo &deviceInfo);
+
     /// Get total LDS size in bytes.
     /// \param[in] gen Hardware generation
     /// \return Total LDS size in bytes if found.
@@ -59,18 +77,36 @@ namespace AMDTDeviceInfoUtils
     /// \return True if any graphics card info is found for CAL device name.
     [[nodiscard]] bool GetDeviceInfo(const char *szCALDeviceName, std::vector<GDT_GfxCardInfo> &cardList);
 
+    /// Get a vector of Graphics Card Info.
+    /// \param[in] calDeviceName CAL device name string, which does not need to be NUL terminated
+    /// \param[out] cardList Output vector of graphics card info.
+    /// \return True if any graphics card info is found for CAL device name.
+    [[nodiscard]] bool GetDeviceInfo(std::string_view calDeviceName, std::vector<GDT_GfxCardInfo> &cardList);
+
     /// Get a vector of Graphics Card Info.
     /// \param[in]  szMarketingDeviceName Marketing device name string
     /// \param[out] cardList Output vector of graphics card info.
     /// \return True if any graphics card info is found for Marketing device name.
     [[nodiscard]] bool GetDeviceInfoMarketingName(const char *szMarketingDeviceName, std::vector<GDT_GfxCardInfo> &cardList);
 
+    /// Get a vector of Graphics Card Info.
+    /// \param[in]  marketingDeviceName Marketing device name string, which does not need to be NUL terminated
+    /// \param[out] cardList Output vector of graphics card info.
+    /// \return True if any graphics card info is found for Marketing device name.
+    [[nodiscard]] bool GetDeviceInfoMarketingName(std::string_view marketingDeviceName, std::vector<GDT_GfxCardInfo> &cardList);
+
     /// Query whether or not input device is APU or not
     /// \param[in] szCALDeviceName CAL device name string
     /// \param[out] bIsAPU flag indicating whether or not the specified device is an APU
     /// \return True if device info is found
     [[nodiscard]] bool IsAPU(const char *szCALDeviceName, bool &bIsAPU);
 
+    /// Query whether or not input device is APU or not
+    /// \param[in] calDeviceName CAL device name string, which does not need to be NUL terminated
+    /// \param[out] bIsAPU flag indicating whether or not the specified device is an APU
+    /// \return True if device info is found
+    [[nodiscard]] bool IsAPU(std::string_view calDeviceName, bool &bIsAPU);
+
     /// Query whether or not input device is APU or not
     /// \param[in] deviceID the PCIE device ID
     /// \param[out] isAPU flag indicating whether or not the specified device is an APU
@@ -89,6 +125,12 @@ namespace AMDTDeviceInfoUtils
     /// \return True if device info is found
     [[nodiscard]] bool GetHardwareGeneration(const char *szCALDeviceName, GDT_HW_GENERATION &gen);
 
+    /// Get hardware generation from device name
+    /// \param[in] calDeviceName Device name, which does not need to be NUL terminated
+    /// \param[out] gen Hardware generation
+    /// \return True if device info is found
+    [[nodiscard]] bool GetHardwareGeneration(std::string_view calDeviceName, GDT_HW_GENERATION &gen);
+
     /// Get all cards in all hardware generations.
     /// \param[out] cardList Output vector of all graphics card info.
     void GetAllCards(std::vector<GDT_GfxCardInfo> &cardList);
@@ -99,6 +141,12 @@ namespace AMDTDeviceInfoUtils
     /// \return True if any graphics card info is found for CAL device name.
     [[nodiscard]] bool GetAllCardsWithName(const char *szCALDeviceName, std::vector<GDT_GfxCardInfo> &cardList);
 
+    /// Get all cards with the specified CAL device name -- this a wrapper around one of the GetDeviceInfo overloads
+    /// \param[in] calDeviceName CAL device name string, which does not need to be NUL terminated
+    /// \param[out] cardList Output vector of graphics card info.
+    /// \return True if any graphics card info is found for CAL device name.
+    [[nodiscard]] bool GetAllCardsWithName(std::string_view calDeviceName, std::vector<GDT_GfxCardInfo> &cardList);
+
     /// Get all cards from the specified hardware generation
     /// \param[in] gen Hardware generation
     /// \param[out] cardList Output vector of graphics card info.
@@ -123,6 +171,11 @@ namespace AMDTDeviceInfoUtils
     /// \return true if successful, false otherwise
     [[nodiscard]] bool GetHardwareGenerationDisplayName(GDT_HW_GENERATION gen, std::string &strGenerationDisplayName);
 
+    /// Get hardware generation display name without allocating
+    /// \param[in] gen Hardware generation
+    /// \return the display name for the specified hardware generation, a view of a string literal; empty if the generation has no display name
+    [[nodiscard]] std::string_view GetHardwareGenerationDisplayName(GDT_HW_GENERATION gen);
+
     /// Determine if the specified device is a member of the specified family
     /// \param[in] szCALDeviceName CAL device name
     /// \param[in] generation Generation enum
@@ -143,6 +196,26 @@ namespace AMDTDeviceInfoUtils
         }
     }
 
+    /// Determine if the specified device is a member of the specified family
+    /// \param[in] calDeviceName CAL device name, which does not need to be NUL terminated
+    /// \param[in] generation Generation enum
+    /// \param[out] bRes Set to true if input device name is a specified family card
+    /// \return false if device name is not found
+    [[nodiscard]] inline bool IsXFamily(std::string_view calDeviceName, GDT_HW_GENERATION generation, bool &bRes)
+    {
+        GDT_HW_GENERATION gen = GDT_HW_GENERATION_NONE;
+
+        if (GetHardwareGeneration(calDeviceName, gen))
+        {
+            bRes = gen == generation;
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
     /// Determine if the specified device is a member of the specified family
     /// \param[in] deviceID the PCIE device ID
     /// \param[in] generation Generation enum
@@ -159,6 +232,15 @@ namespace AMDTDeviceInfoUtils
         return IsXFamily(szCALDeviceName, GDT_HW_GENERATION_GFX12, bIsGfx12);
     }
 
+    /// Determine if the specified device is a member of the Gfx12 family
+    /// \param[in] calDeviceName CAL device name, which does not need to be NUL terminated
+    /// \param[out] bIsGfx12 Set to true if input device name is a member of the Gfx12 family
+    /// \return false if device name is not found
+    [[nodiscard]] inline bool IsGfx12Family(std::string_view calDeviceName, bool &bIsGfx12)
+    {
+        return IsXFamily(calDeviceName, GDT_HW_GENERATION_GFX12, bIsGfx12);
+    }
+
     /// Determine if the specified device is a member of the Gfx12 family
     /// \param[in] deviceID the PCIE device ID
     /// \param[out] isGfx12 Set to true if input device name is a member of the Gfx12 family
@@ -174,6 +256,15 @@ namespace AMDTDeviceInfoUtils
         return IsXFamily(szCALDeviceName, GDT_HW_GENERATION_GFX11, bIsGfx11);
     }
 
+    /// Determine if the specified device is a member of the Gfx11 family
+    /// \param[in] calDeviceName CAL device name, which does not need to be NUL terminated
+    /// \param[out] bIsGfx11 Set to true if input device name is a member of the Gfx11 family
+    /// \return false if device name is not found
+    [[nodiscard]] inline bool IsGfx11Family(std::string_view calDeviceName, bool &bIsGfx11)
+    {
+        return IsXFamily(calDeviceName, GDT_HW_GENERATION_GFX11, bIsGfx11);
+    }
+
     /// Determine if the specified device is a member of the Gfx11 family
     /// \param[in] deviceID the PCIE device ID
     /// \param[out] isGfx11 Set to true if input device name is a member of the Gfx11 family
@@ -189,6 +280,15 @@ namespace AMDTDeviceInfoUtils
         return IsXFamily(szCALDeviceName, GDT_HW_GENERATION_GFX10, bIsGfx10);
     }
 
+    /// Determine if the specified device is a member of the Gfx10 family
+    /// \param[in] calDeviceName CAL device name, which does not need to be NUL terminated
+    /// \param[out] bIsGfx10 Set to true if input device name is a member of the Gfx10 family
+    /// \return false if device name is not found
+    [[nodiscard]] inline bool IsGfx10Family(std::string_view calDeviceName, bool &bIsGfx10)
+    {
+        return IsXFamily(calDeviceName, GDT_HW_GENERATION_GFX10, bIsGfx10);
+    }
+
     /// Determine if the specified device is a member of the Gfx10 family
     /// \param[in] deviceID the PCIE device ID
     /// \param[out] isGfx10 Set to true if input device name is a member of the Gfx10 family
@@ -204,6 +304,15 @@ namespace AMDTDeviceInfoUtils
         return IsXFamily(szCALDeviceName, GDT_HW_GENERATION_GFX9, bIsGfx9);
     }
 
+    /// Determine if the specified device is a member of the Gfx9 family
+    /// \param[in] calDeviceName CAL device name, which does not need to be NUL terminated
+    /// \param[out] bIsGfx9 Set to true if input device name is a member of the Gfx9 family
+    /// \return false if device name is not found
+    [[nodiscard]] inline bool IsGfx9Family(std::string_view calDeviceName, bool &bIsGfx9)
+    {
+        return IsXFamily(calDeviceName, GDT_HW_GENERATION_GFX9, bIsGfx9);
+    }
+
     /// Determine if the specified device is a member of the Gfx9 family
     /// \param[in] deviceID the PCIE device ID
     /// \param[out] isGfx9 Set to true if input device name is a member of the Gfx9 family
@@ -219,6 +328,15 @@ namespace AMDTDeviceInfoUtils
         return IsXFamily(szCALDeviceName, GDT_HW_GENERATION_VOLCANICISLAND, bIsVI);
     }
 
+    /// Determine if the specified device is a member of the VI family
+    /// \param[in] calDeviceName CAL device name, which does not need to be NUL terminated
+    /// \param[out] bIsVI Set to true if input device name is a member of the VI family
+    /// \return false if device name is not found
+    [[nodiscard]] inline bool IsVIFamily(std::string_view calDeviceName, bool &bIsVI)
+    {
+        return IsXFamily(calDeviceName, GDT_HW_GENERATION_VOLCANICISLAND, bIsVI);
+    }
+
     /// Determine if the specified device is a member of the VI family
     /// \param[in] deviceID the PCIE device ID
     /// \param[out] isVI Set to true if input device name is a member of the VI family
@@ -234,6 +352,15 @@ namespace AMDTDeviceInfoUtils
         return IsXFamily(szCALDeviceName, GDT_HW_GENERATION_SEAISLAND, bIsCI);
     }
 
+    /// Determine if the specified device is a member of the CI family
+    /// \param[in] calDeviceName CAL device name, which does not need to be NUL terminated
+    /// \param[out] bIsCI Set to true if input device name is a member of the CI family
+    /// \return false if device name is not found
+    [[nodiscard]] inline bool IsCIFamily(std::string_view calDeviceName, bool &bIsCI)
+    {
+        return IsXFamily(calDeviceName, GDT_HW_GENERATION_SEAISLAND, bIsCI);
+    }
+
     /// Determine if the specified device is a member of the CI family
     /// \param[in] deviceID the PCIE device ID
     /// \param[out] isCI Set to true if input device name is a member of the CI family
@@ -249,6 +376,15 @@ namespace AMDTDeviceInfoUtils
         return IsXFamily(szCALDeviceName, GDT_HW_GENERATION_SOUTHERNISLAND, bIsSI);
     }
 
+    /// Determine if the specified device is a member of the SI family
+    /// \param[in] calDeviceName CAL device name, which does not need to be NUL terminated
+    /// \param[out] bIsSI Set to true if input device name is a member of the SI family
+    /// \return false if device name is not found
+    [[nodiscard]] inline bool IsSIFamily(std::string_view calDeviceName, bool &bIsSI)
+    {
+        return IsXFamily(calDeviceName, GDT_HW_GENERATION_SOUTHERNISLAND, bIsSI);
+    }
+
     /// Determine if the specified device is a member of the SI family
     /// \param[in] deviceID the PCIE device ID
     /// \param[out] isSI Set to true if input device name is a member of the SI family
@@ -256,19 +392,28 @@ namespace AMDTDeviceInfoUtils
     [[nodiscard]] bool IsSIFamily(uint32_t deviceID, bool &isSI);
 
     /// Translates the reported device name to the true device name exposed in the DeviceInfo table.
+    /// Returns a new string, so hot paths should use the string_view overload instead.
     /// \param strDeviceName the device name reported by the runtime.
     /// \return the true device name as exposed by the device info table.
     [[nodiscard]] std::string TranslateDeviceName(const char *strDeviceName);
 
+    /// Translates the reported device name to the true device name exposed in the DeviceInfo table.
+    /// Only allocates if a DeviceNameTranslatorFunction is installed, since that function needs a NUL terminated copy of the name.
+    /// \param deviceName the device name reported by the runtime, which does not need to be NUL terminated.
+    /// \param[out] storage backing storage for the result when a DeviceNameTranslatorFunction is installed.
+    /// \return the true device name as exposed by the device info table, valid as long as deviceName and storage are.
+    [[nodiscard]] std::string_view TranslateDeviceName(std::string_view deviceName, std::string &storage);
+
     /// Converts gfxIPVersion to GDT_HW_GENERATION
-    /// \param gfxIPVer the graphics IP version whose corresponding GDT_HW_GENERATION is needed
+    /// Use GfxIpVersionToHwGeneration to tell apart the generations that share a major version, such as GFX10.3 and the CDNA generations.
+    /// \param gfxIPVer the major graphics IP version whose corresponding GDT_HW_GENERATION is needed
     /// \param[out] hwGen the GDT_HW_GENERATION that corresponds to the specified graphics IP version
     /// \return true on success, false if there is no equivalent GDT_HW_GENERATION
     [[nodiscard]] bool GfxIPVerToHwGeneration(uint32_t gfxIPVer, GDT_HW_GENERATION &hwGen);
 
     /// Converts GDT_HW_GENERATION to gfxIPVersion
     /// \param hwGen the GDT_HW_GENERATION whose corresponding graphics IP version is needed
-    /// \param[out] gfxIPVer the graphics IP version that corresponds to the specified GDT_HW_GENERATION
+    /// \param[out] gfxIPVer the major graphics IP version that corresponds to the specified GDT_HW_GENERATION, e.g. 10 for GDT_HW_GENERATION_GFX103
     /// \return true on success, false if there is no equivalent graphics IP version
     [[nodiscard]] bool HwGenerationToGfxIPVer(GDT_HW_GENERATION hwGen, uint32_t &gfxIPVer);
 } // namespace AMDTDeviceInfoUtils
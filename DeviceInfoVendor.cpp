@@ -0,0 +1,320 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Vendor-qualified device lookups and pluggable device tables for other vendors.
+//==============================================================================
+
+#include "DeviceInfoVendor.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <bit>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <vector>
+
+#include "DeviceInfoIndex.h"
+#include "DeviceInfoLookupCache.h"
+#include "DeviceInfoMissRecorder.h"
+#include "DeviceInfoOverride.h"
+#include "DeviceInfoQuery.h"
+#include "DeviceInfoTraceRecorder.h"
+
+namespace
+{
+    using AMDTDeviceInfoUtils::VendorBackend;
+
+    /// A vendor's device table, indexed by device ID.
+    struct IndexedBackend
+    {
+        /// A hash table slot. Slots with an empty range are unused.
+        struct Slot
+        {
+            uint32_t deviceID = 0; ///< The device ID.
+            uint32_t begin    = 0; ///< Index of the first device with the device ID in devices.
+            uint32_t end      = 0; ///< One past the index of the last device with the device ID in devices.
+        };
+
+        VendorBackend         backend;      ///< The device table.
+        std::vector<uint32_t> devices;      ///< Indexes into the device table, grouped by device ID and in table order within a group.
+        std::vector<Slot>     slots;        ///< The hash table.
+        int                   slotBits = 0; ///< Log2 of the number of slots.
+
+        explicit IndexedBackend(const VendorBackend &vendorBackend)
+            : backend(vendorBackend)
+            , devices(vendorBackend.cards.size())
+        {
+            auto device_id = [this](uint32_t device)
+            { return backend.cards[device].m_deviceID; };
+
+            std::iota(devices.begin(), devices.end(), 0);
+            std::ranges::stable_sort(devices, {}, device_id);
+
+            size_t deviceIdCount = 0;
+            for (size_t i = 0; i < devices.size(); ++i)
+            {
+                if (i == 0 || device_id(devices[i]) != device_id(devices[i - 1]))
+                {
+                    ++deviceIdCount;
+                }
+            }
+
+            const size_t slotCount = AMDTDeviceInfoUtils::Internal::SlotCountFor(deviceIdCount);
+            slotBits               = std::countr_zero(slotCount);
+            slots.resize(slotCount);
+
+            for (uint32_t begin = 0; begin < devices.size();)
+            {
+                const uint32_t deviceID = device_id(devices[begin]);
+                uint32_t       end      = begin + 1;
+                while (end < devices.size() && device_id(devices[end]) == deviceID)
+                {
+                    ++end;
+                }
+
+                size_t slot = AMDTDeviceInfoUtils::Internal::HomeSlot(deviceID, slotBits);
+                while (slots[slot].begin != slots[slot].end)
+                {
+                    slot = (slot + 1) & (slotCount - 1);
+                }
+                slots[slot] = {deviceID, begin, end};
+
+                begin = end;
+            }
+        }
+
+        /// Find the first device with a device ID and revision ID.
+        /// \return the index of the device in the device table, or -1 if there is none
+        [[nodiscard]] ptrdiff_t Find(uint32_t deviceID, uint32_t revisionID) const
+        {
+            for (size_t slot = AMDTDeviceInfoUtils::Internal::HomeSlot(deviceID, slotBits);; slot = (slot + 1) & (slots.size() - 1))
+            {
+                const Slot &candidate = slots[slot];
+                if (candidate.begin == candidate.end)
+                {
+                    return -1;
+                }
+                if (candidate.deviceID != deviceID)
+                {
+                    continue;
+                }
+
+                for (uint32_t i = candidate.begin; i < candidate.end; ++i)
+                {
+                    if (AMDTDeviceInfoUtils::kRevisionIdAny == revisionID || backend.cards[devices[i]].m_revID == revisionID)
+                    {
+                        return devices[i];
+                    }
+                }
+                return -1;
+            }
+        }
+    };
+
+    /// An immutable set of registered vendor device tables.
+    struct BackendSnapshot
+    {
+        std::vector<std::shared_ptr<const IndexedBackend>> backends; ///< The device tables, at most one per vendor.
+
+        /// Find the device table of a vendor.
+        [[nodiscard]] const IndexedBackend *Find(uint32_t vendorID) const
+        {
+            for (const auto &backend : backends)
+            {
+                if (backend->backend.vendorID == vendorID)
+                {
+                    return backend.get();
+                }
+            }
+            return nullptr;
+        }
+    };
+
+    std::atomic<const BackendSnapshot *> gs_backendSnapshot = nullptr; ///< The registered device tables, nullptr if there are none.
+
+    std::mutex                                    gs_backendMutex;     ///< Serializes the writers of gs_backendSnapshot.
+    std::vector<std::unique_ptr<BackendSnapshot>> gs_backendSnapshots; ///< Every snapshot published since ReleaseRetiredVendorBackends, kept alive since readers do not lock.
+
+    /// Publish a new set of device tables, derived from the current one.
+    /// \param update called with a copy of the current set of device tables to modify
+    template <typename Update>
+    void UpdateBackends(Update &&update)
+    {
+        std::lock_guard<std::mutex> lock(gs_backendMutex);
+
+        auto                   snapshot = std::make_unique<BackendSnapshot>();
+        const BackendSnapshot *current  = gs_backendSnapshot.load(std::memory_order_relaxed);
+        if (nullptr != current)
+        {
+            snapshot->backends = current->backends;
+        }
+
+        update(snapshot->backends);
+
+        // Keep the snapshot alive before publishing it, so readers never see a snapshot that is freed if push_back throws.
+        const BackendSnapshot *published = snapshot->backends.empty() ? nullptr : snapshot.get();
+        gs_backendSnapshots.push_back(std::move(snapshot));
+
+        gs_backendSnapshot.store(published, std::memory_order_release);
+        AMDTDeviceInfoUtils::Internal::InvalidateLookupCaches();
+    }
+
+    /// A device in the device table of a vendor.
+    struct VendorDevice
+    {
+        const IndexedBackend *backend = nullptr; ///< The device table, nullptr if the device is not found.
+        size_t                device  = 0;       ///< Index of the device in the device table.
+    };
+
+    /// The last vendor device lookups of this thread.
+    constinit thread_local AMDTDeviceInfoUtils::Internal::LookupCache<AMDTDeviceInfoUtils::Internal::DeviceLookupKey, VendorDevice> gs_vendorDeviceCache;
+
+    /// Find a device of a vendor other than AMD.
+    /// \return the device table of the vendor and the index of the device in it, or nullptr if the device is not found
+    const IndexedBackend *FindVendorDevice(uint32_t vendorID, uint32_t deviceID, uint32_t revisionID, size_t &device)
+    {
+        AMDTDeviceInfoUtils::Internal::TraceLookup(AMDTDeviceInfoUtils::LookupTraceApi::kDeviceId, vendorID, deviceID, revisionID);
+
+        auto find_device = [&]() -> VendorDevice
+        {
+            const BackendSnapshot *snapshot = gs_backendSnapshot.load(std::memory_order_acquire);
+            const IndexedBackend  *backend  = (nullptr != snapshot) ? snapshot->Find(vendorID) : nullptr;
+            const ptrdiff_t        index    = (nullptr != backend) ? backend->Find(deviceID, revisionID) : -1;
+            return (index >= 0) ? VendorDevice{backend, static_cast<size_t>(index)} : VendorDevice{};
+        };
+
+        const VendorDevice found = gs_vendorDeviceCache.Get({vendorID, deviceID, revisionID}, find_device);
+        if (nullptr == found.backend)
+        {
+            AMDTDeviceInfoUtils::Internal::RecordLookupMiss(AMDTDeviceInfoUtils::LookupTraceApi::kDeviceId, vendorID, deviceID, revisionID);
+        }
+
+        device = found.device;
+        return found.backend;
+    }
+} // namespace
+
+bool AMDTDeviceInfoUtils::RegisterVendorBackend(const VendorBackend &backend)
+{
+    if (kAmdVendorId == backend.vendorID || backend.cards.size() != backend.deviceInfo.size())
+    {
+        return false;
+    }
+
+    auto indexed = std::make_shared<const IndexedBackend>(backend);
+
+    UpdateBackends(
+        [&](std::vector<std::shared_ptr<const IndexedBackend>> &backends)
+        {
+            std::erase_if(backends, [&](const auto &registered) { return registered->backend.vendorID == backend.vendorID; });
+            backends.push_back(std::move(indexed));
+        });
+
+    return true;
+}
+
+void AMDTDeviceInfoUtils::UnregisterVendorBackend(uint32_t vendorID)
+{
+    UpdateBackends([&](std::vector<std::shared_ptr<const IndexedBackend>> &backends)
+                   { std::erase_if(backends, [&](const auto &registered) { return registered->backend.vendorID == vendorID; }); });
+}
+
+void AMDTDeviceInfoUtils::ReleaseRetiredVendorBackends()
+{
+    std::lock_guard<std::mutex> lock(gs_backendMutex);
+
+    // The device tables of the current snapshot are shared with the retired ones, so only the indexes of removed tables are freed.
+    const BackendSnapshot *current = gs_backendSnapshot.load(std::memory_order_relaxed);
+    std::erase_if(gs_backendSnapshots, [current](const std::unique_ptr<BackendSnapshot> &snapshot) { return snapshot.get() != current; });
+}
+
+bool AMDTDeviceInfoUtils::GetDeviceInfo(uint32_t vendorID, uint32_t deviceID, uint32_t revisionID, GDT_DeviceInfo &deviceInfo)
+{
+    if (kAmdVendorId == vendorID)
+    {
+        return GetDeviceInfo(deviceID, revisionID, deviceInfo);
+    }
+
+    size_t                device  = 0;
+    const IndexedBackend *backend = FindVendorDevice(vendorID, deviceID, revisionID, device);
+    const bool            found   = nullptr != backend;
+    if (found)
+    {
+        deviceInfo = backend->backend.deviceInfo[device];
+    }
+    return found;
+}
+
+bool AMDTDeviceInfoUtils::GetDeviceInfo(uint32_t vendorID, uint32_t deviceID, uint32_t revisionID, GDT_GfxCardInfo &cardInfo)
+{
+    if (kAmdVendorId == vendorID)
+    {
+        return GetDeviceInfo(deviceID, revisionID, cardInfo);
+    }
+
+    size_t                device  = 0;
+    const IndexedBackend *backend = FindVendorDevice(vendorID, deviceID, revisionID, device);
+    const bool            found   = nullptr != backend;
+    if (found)
+    {
+        cardInfo = backend->backend.cards[device];
+    }
+    return found;
+}
+
+size_t AMDTDeviceInfoUtils::ResolveDevices(std::span<const DeviceQuery> queries, std::span<ResolvedDevice> results)
+{
+    assert(results.size() >= queries.size());
+
+    const BackendSnapshot *snapshot = gs_backendSnapshot.load(std::memory_order_acquire);
+    const IndexedBackend  *backend  = nullptr; // The device table of the previous query's vendor, since batches rarely mix many vendors.
+    size_t                 found    = 0;
+
+    for (size_t i = 0; i < queries.size(); ++i)
+    {
+        const DeviceQuery &query  = queries[i];
+        ResolvedDevice    &result = results[i];
+        result                    = {};
+
+        Internal::TraceLookup(LookupTraceApi::kResolveDevices, query.vendorID, query.deviceID, query.revisionID);
+
+        if (kAmdVendorId == query.vendorID)
+        {
+            for (CardHandle card : FindCardsByDeviceId(query.deviceID))
+            {
+                if (kRevisionIdAny == query.revisionID || gs_cardInfo[card].m_revID == query.revisionID)
+                {
+                    result = {&gs_cardInfo[card], &GetCardDeviceInfo(card)};
+                    break;
+                }
+            }
+        }
+        else if (nullptr != snapshot)
+        {
+            if (nullptr == backend || backend->backend.vendorID != query.vendorID)
+            {
+                backend = snapshot->Find(query.vendorID);
+            }
+
+            const ptrdiff_t device = (nullptr != backend) ? backend->Find(query.deviceID, query.revisionID) : -1;
+            if (device >= 0)
+            {
+                result = {&backend->backend.cards[static_cast<size_t>(device)], &backend->backend.deviceInfo[static_cast<size_t>(device)]};
+            }
+        }
+
+        if (nullptr != result.cardInfo)
+        {
+            ++found;
+        }
+        else
+        {
+            Internal::RecordLookupMiss(LookupTraceApi::kResolveDevices, query.vendorID, query.deviceID, query.revisionID);
+        }
+    }
+
+    return found;
+}
@@ -0,0 +1,95 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Vendor-qualified device lookups and pluggable device tables for other vendors.
+//==============================================================================
+
+#ifndef DEVICE_INFO_DEVICE_INFO_VENDOR_H_
+#define DEVICE_INFO_DEVICE_INFO_VENDOR_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "DeviceInfoUtils.h"
+
+namespace AMDTDeviceInfoUtils
+{
+    constexpr uint32_t kAmdVendorId    = 0x1002; ///< PCI vendor ID of AMD graphics devices, which are looked up in the card info table.
+    constexpr uint32_t kNvidiaVendorId = 0x10DE; ///< PCI vendor ID of NVIDIA.
+    constexpr uint32_t kIntelVendorId  = 0x8086; ///< PCI vendor ID of Intel.
+
+    /// A device table for the devices of a vendor other than AMD.
+    /// The tables are referenced, not copied, so they need to outlive every lookup, e.g. by being static.
+    struct VendorBackend
+    {
+        uint32_t                         vendorID = 0; ///< PCI vendor ID of the devices.
+        std::span<const GDT_GfxCardInfo> cards;        ///< The devices. m_asicType is not used and can be GDT_ASIC_TYPE_NONE.
+        std::span<const GDT_DeviceInfo>  deviceInfo;   ///< The device info of each device, in the same order as cards.
+    };
+
+    /// A device to look up with ResolveDevices.
+    struct DeviceQuery
+    {
+        uint32_t vendorID   = kAmdVendorId;   ///< PCI vendor ID.
+        uint32_t deviceID   = 0;              ///< Device ID.
+        uint32_t revisionID = kRevisionIdAny; ///< Revision ID, kRevisionIdAny if revision ID is not important.
+    };
+
+    /// The result of looking up a device with ResolveDevices.
+    struct ResolvedDevice
+    {
+        const GDT_GfxCardInfo *cardInfo   = nullptr; ///< The card info, nullptr if the device is not found.
+        const GDT_DeviceInfo  *deviceInfo = nullptr; ///< The device info, including any override of an AMD device; nullptr if the device is not found.
+    };
+
+    /// Register the device table of a vendor, replacing any table registered for the vendor before.
+    /// The devices are indexed by device ID once, here, so lookups cost the same as for AMD devices. Lookups may run concurrently
+    /// with this function. The index of a table that is replaced or unregistered stays allocated until ReleaseRetiredVendorBackends
+    /// is called, or until the process exits; register backends once, e.g. at startup.
+    /// \param[in] backend the device table
+    /// \return false if the vendor ID is kAmdVendorId or the device table and the device info table differ in size
+    bool RegisterVendorBackend(const VendorBackend &backend);
+
+    /// Remove the device table of a vendor.
+    /// Lookups may run concurrently with this function, so the index of the table is not freed here; see ReleaseRetiredVendorBackends.
+    /// \param[in] vendorID PCI vendor ID
+    void UnregisterVendorBackend(uint32_t vendorID);
+
+    /// Free the indexes of the device tables that were replaced or unregistered.
+    /// Lookups read the registered tables without locking, so the indexes of removed tables are kept for lookups that may still be
+    /// reading them. Call this only while no lookup runs on any thread, e.g. after joining the threads that made lookups; afterwards
+    /// the removed tables themselves may be freed as well.
+    void ReleaseRetiredVendorBackends();
+
+    /// Get device info from vendor ID and device ID.
+    /// Devices of a vendor without a registered device table are rejected without looking at any device table.
+    /// \param[in] vendorID PCI vendor ID
+    /// \param[in] deviceID Device ID
+    /// \param[in] revisionID Revision ID, pass kRevisionIdAny if revision ID is not important.
+    /// \param[out] deviceInfo Output device info if the device is found.
+    /// \return True if device info is found
+    [[nodiscard]] bool GetDeviceInfo(uint32_t vendorID, uint32_t deviceID, uint32_t revisionID, GDT_DeviceInfo &deviceInfo);
+
+    /// Get card info from vendor ID and device ID.
+    /// Devices of a vendor without a registered device table are rejected without looking at any device table.
+    /// \param[in] vendorID PCI vendor ID
+    /// \param[in] deviceID Device ID
+    /// \param[in] revisionID Revision ID, pass kRevisionIdAny if revision ID is not important.
+    /// \param[out] cardInfo Output card info if the device is found.
+    /// \return True if card info is found
+    [[nodiscard]] bool GetDeviceInfo(uint32_t vendorID, uint32_t deviceID, uint32_t revisionID, GDT_GfxCardInfo &cardInfo);
+
+    /// Look up a batch of devices.
+    /// The registered device tables are read once per batch instead of once per device, and nothing is copied or allocated, so this
+    /// is the fastest way to resolve many devices. The results point into the card info table, which stays valid until the process
+    /// exits, the registered overrides and the registered device tables. A result from a device table stays valid while the table
+    /// is registered, and after it is replaced or unregistered until ReleaseRetiredVendorBackends is called and the caller frees it.
+    /// \param[in] queries the devices to look up
+    /// \param[out] results the result of each query, in the same order; must be at least as large as queries
+    /// \return the number of devices found
+    size_t ResolveDevices(std::span<const DeviceQuery> queries, std::span<ResolvedDevice> results);
+} // namespace AMDTDeviceInfoUtils
+
+#endif
@@ -0,0 +1,270 @@
+#!/usr/bin/env python3
+## Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved. ##
+"""Generate the device info tables from the data files in data/.
+
+data/asic_types.csv lists the ASIC types in GDT_HW_ASIC_TYPE order, together with their graphics IP version, written as a
+gfx target name such as gfx90a, and their GDT_DeviceInfo.
+data/cards.csv lists the cards in GDT_GfxCardInfo table order. Empty lines separate groups of cards and are kept.
+
+Outputs:
+  <include-dir>/DeviceInfoGenerated.h  the GDT_HW_ASIC_TYPE enum and kCardInfoCount, included by DeviceInfo.h
+  <source-dir>/DeviceInfoTable.h       the kCardInfo and kDeviceInfo tables, shared by the library sources and,
+                                       with DEVICE_INFO_INLINE_TABLES, included by DeviceInfo.h
+  <source-dir>/DeviceInfoGfxIpTable.h  the kAsicGfxIpVersions table, included by DeviceInfoGfxTarget.cpp only
+"""
+
+import argparse
+import csv
+import os
+import re
+import sys
+
+HEADER_BANNER = """//==============================================================================
+/// Copyright (c) 2010-2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief {brief}
+///
+/// Generated by scripts/generate_device_info_tables.py from data/asic_types.csv and data/cards.csv. Do not edit.
+//==============================================================================
+"""
+
+DEVICE_INFO_FIELDS = [
+    # (column, maximum value)
+    ("num_shader_engines", 0xFF),
+    ("max_wave_per_simd", 0xFF),
+    ("su_clocks_prim", 0xFF),
+    ("num_sq_max_counters", 0xFF),
+    ("num_prim_pipes", 0xFF),
+    ("wave_size", 0xFF),
+    ("num_sh_per_se", 0xFF),
+    ("num_cus", 0xFF),
+    ("num_simd_per_cu", 0xFF),
+    ("num_vgpr_per_simd", 0xFFFF),
+]
+
+# A gfx target name in the canonical spelling accepted by ParseGfxTarget: the major version in decimal, then the minor
+# version and the stepping as one lower case hexadecimal digit each.
+GFX_TARGET_PATTERN = re.compile(r"gfx([1-9][0-9]?)([0-9a-f])([0-9a-f])")
+
+CARD_FIELDS = ["asic_type", "device_id", "revision_id", "generation", "apu", "cal_name", "marketing_name"]
+
+
+class DataError(Exception):
+    """An error in a data file."""
+
+
+def read_rows(path, columns):
+    """Read the rows of a CSV file, checking its header. Empty lines are returned as None."""
+    with open(path, newline="", encoding="utf-8") as data_file:
+        reader = csv.reader(data_file)
+        header = next(reader, None)
+        if header != columns:
+            raise DataError(f"{path}:1: expected the columns {','.join(columns)}")
+        for row in reader:
+            if not row:
+                yield reader.line_num, None
+                continue
+            if len(row) != len(columns):
+                raise DataError(f"{path}:{reader.line_num}: expected {len(columns)} columns, found {len(row)}")
+            yield reader.line_num, dict(zip(columns, row))
+
+
+def parse_int(path, line, text, maximum, base=10):
+    """Parse an integer column."""
+    try:
+        value = int(text, base)
+    except ValueError:
+        raise DataError(f"{path}:{line}: '{text}' is not a number") from None
+    if not 0 <= value <= maximum:
+        raise DataError(f"{path}:{line}: {value} is out of range")
+    return value
+
+
+def c_string(text):
+    """Quote a string as a C++ string literal."""
+    return '"' + text.replace("\\", "\\\\").replace('"', '\\"') + '"'
+
+
+def parse_gfx_target(path, line, text):
+    """Parse a gfx target name into its major version, minor version and stepping."""
+    match = GFX_TARGET_PATTERN.fullmatch(text)
+    if match is None:
+        raise DataError(f"{path}:{line}: '{text}' is not a gfx target name such as gfx1030 or gfx90a")
+    return int(match.group(1)), int(match.group(2), 16), int(match.group(3), 16)
+
+
+def read_asic_types(path):
+    """Read the ASIC types, their graphics IP versions and their device info."""
+    asic_types = []
+    names = set()
+    columns = ["asic_type", "description", "gfx_ip_version"] + [column for column, _ in DEVICE_INFO_FIELDS]
+    for line, row in read_rows(path, columns):
+        if row is None:
+            continue
+        name = row["asic_type"]
+        if not name.startswith("GDT_") or not name.isidentifier():
+            raise DataError(f"{path}:{line}: '{name}' is not a GDT_ identifier")
+        if name in names:
+            raise DataError(f"{path}:{line}: duplicate ASIC type {name}")
+        names.add(name)
+
+        fields = []
+        for column, maximum in DEVICE_INFO_FIELDS:
+            # An empty VGPR count means the number of VGPRs is unknown, as for GPUs older than GFX10.
+            if column == "num_vgpr_per_simd" and row[column] == "":
+                fields.append("kUnknownVgprsPerSIMD")
+            else:
+                fields.append(str(parse_int(path, line, row[column], maximum)))
+        gfx_ip_version = parse_gfx_target(path, line, row["gfx_ip_version"])
+        asic_types.append((name, row["description"], gfx_ip_version, fields))
+    return asic_types
+
+
+def read_cards(path, asic_type_names):
+    """Read the cards. Empty lines are returned as None."""
+    cards = []
+    for line, row in read_rows(path, CARD_FIELDS):
+        if row is None:
+            cards.append(None)
+            continue
+        if row["asic_type"] not in asic_type_names:
+            raise DataError(f"{path}:{line}: unknown ASIC type {row['asic_type']}")
+        if not row["generation"].startswith("GDT_HW_GENERATION_") or not row["generation"].isidentifier():
+            raise DataError(f"{path}:{line}: '{row['generation']}' is not a GDT_HW_GENERATION_ identifier")
+        if row["apu"] not in ("true", "false"):
+            raise DataError(f"{path}:{line}: apu needs to be true or false")
+        for column in ("device_id", "revision_id"):
+            if not row[column].startswith("0x"):
+                raise DataError(f"{path}:{line}: {column} needs to be a hexadecimal number starting with 0x")
+            parse_int(path, line, row[column][2:], 0xFFFFFFFF, 16)
+        cards.append(row)
+
+    # Drop the empty lines at the ends, which do not separate groups.
+    while cards and cards[-1] is None:
+        cards.pop()
+    while cards and cards[0] is None:
+        cards.pop(0)
+    return cards
+
+
+def generate_public_header(asic_types, cards):
+    """Generate DeviceInfoGenerated.h."""
+    enumerators = [("GDT_ASIC_TYPE_NONE = -1,", "Undefined asic")]
+    enumerators += [(f"{name} = 0," if index == 0 else f"{name},", description) for index, (name, description, _, _) in enumerate(asic_types)]
+    enumerators += [("GDT_LAST", "Last")]
+    width = max(len(enumerator) for enumerator, _ in enumerators)
+
+    lines = [HEADER_BANNER.format(brief="ASIC types and table sizes of the device info table.")]
+    lines.append("#ifndef DEVICE_INFO_DEVICE_INFO_GENERATED_H_")
+    lines.append("#define DEVICE_INFO_DEVICE_INFO_GENERATED_H_")
+    lines.append("")
+    lines.append("#include <cstddef>")
+    lines.append("")
+    lines.append("/// Specifies the Asic type.")
+    lines.append("enum GDT_HW_ASIC_TYPE")
+    lines.append("{")
+    for enumerator, description in enumerators:
+        lines.append(f"    {enumerator:<{width}} ///< {description}")
+    lines.append("};")
+    lines.append("")
+    lines.append("/// Number of entries in the card info table.")
+    lines.append(f"constexpr size_t kCardInfoCount = {sum(card is not None for card in cards)};")
+    lines.append("")
+    lines.append("#endif")
+    return "\n".join(lines) + "\n"
+
+
+def generate_table_header(asic_types, cards):
+    """Generate DeviceInfoTable.h."""
+    lines = [HEADER_BANNER.format(brief="Device info table data, shared by the translation units that build lookup indexes over it.")]
+    lines.append("#ifndef DEVICE_INFO_DEVICE_INFO_TABLE_H_")
+    lines.append("#define DEVICE_INFO_DEVICE_INFO_TABLE_H_")
+    lines.append("")
+    lines.append("#include <iterator>")
+    lines.append("")
+    lines.append('#include "DeviceInfo.h"')
+    lines.append("")
+    lines.append("inline constexpr GDT_GfxCardInfo kCardInfo[] = {")
+    for card in cards:
+        if card is None:
+            lines.append("")
+            continue
+        lines.append(
+            f"    {{{card['asic_type']}, {card['device_id']}, {card['revision_id']}, {card['generation']}, {card['apu']}, "
+            f"{c_string(card['cal_name'])}, {c_string(card['marketing_name'])}}},"
+        )
+    lines.append("};")
+    lines.append("")
+    lines.append('static_assert(std::size(kCardInfo) == kCardInfoCount, "kCardInfoCount needs to match the number of entries in kCardInfo.");')
+    lines.append("")
+    lines.append("// GPUs older than GFX10 have an unknown number of VGPRs per SIMD.")
+    lines.append("inline constexpr size_t kUnknownVgprsPerSIMD = 0;")
+    lines.append("")
+    lines.append("inline constexpr GDT_DeviceInfo kDeviceInfo[] = {")
+    rows = [f"{{{', '.join(fields)}}}," for _, _, _, fields in asic_types]
+    width = max(len(row) for row in rows)
+    for row, (name, _, _, _) in zip(rows, asic_types):
+        lines.append(f"    {row:<{width}} // {name}")
+    lines.append("};")
+    lines.append("")
+    lines.append('static_assert(std::size(kDeviceInfo) == GDT_LAST, "kDeviceInfo needs to have the same number of entries as the GDT_HW_ASIC_TYPE enum.");')
+    lines.append("")
+    lines.append("#endif")
+    return "\n".join(lines) + "\n"
+
+
+def generate_gfx_ip_table_header(asic_types):
+    """Generate DeviceInfoGfxIpTable.h."""
+    lines = [HEADER_BANNER.format(brief="Graphics IP version of each ASIC type, used to map between ASIC types, gfx targets and generations.")]
+    lines.append("#ifndef DEVICE_INFO_DEVICE_INFO_GFX_IP_TABLE_H_")
+    lines.append("#define DEVICE_INFO_DEVICE_INFO_GFX_IP_TABLE_H_")
+    lines.append("")
+    lines.append("#include <iterator>")
+    lines.append("")
+    lines.append('#include "DeviceInfoGfxTarget.h"')
+    lines.append("")
+    lines.append("/// The graphics IP version of each ASIC type, in enum order.")
+    lines.append("inline constexpr AMDTDeviceInfoUtils::GfxTargetKey kAsicGfxIpVersions[] = {")
+    rows = [f"AMDTDeviceInfoUtils::MakeGfxTargetKey({major}, {minor}, {stepping:#x})," for _, _, (major, minor, stepping), _ in asic_types]
+    width = max(len(row) for row in rows)
+    for row, (name, _, _, _) in zip(rows, asic_types):
+        lines.append(f"    {row:<{width}} // {name}")
+    lines.append("};")
+    lines.append("")
+    lines.append('static_assert(std::size(kAsicGfxIpVersions) == GDT_LAST, "kAsicGfxIpVersions needs to have the same number of entries as the GDT_HW_ASIC_TYPE enum.");')
+    lines.append("")
+    lines.append("#endif")
+    return "\n".join(lines) + "\n"
+
+
+def write_file(path, contents):
+    """Write a generated file."""
+    os.makedirs(os.path.dirname(path), exist_ok=True)
+    with open(path, "w", encoding="utf-8", newline="\n") as output:
+        output.write(contents)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--asic-types", required=True, help="path of asic_types.csv")
+    parser.add_argument("--cards", required=True, help="path of cards.csv")
+    parser.add_argument("--include-dir", required=True, help="directory to write the public header to")
+    parser.add_argument("--source-dir", required=True, help="directory to write the private header to")
+    args = parser.parse_args()
+
+    try:
+        asic_types = read_asic_types(args.asic_types)
+        cards = read_cards(args.cards, {name for name, _, _, _ in asic_types})
+    except DataError as error:
+        print(f"error: {error}", file=sys.stderr)
+        return 1
+
+    write_file(os.path.join(args.include_dir, "DeviceInfoGenerated.h"), generate_public_header(asic_types, cards))
+    write_file(os.path.join(args.source_dir, "DeviceInfoTable.h"), generate_table_header(asic_types, cards))
+    write_file(os.path.join(args.source_dir, "DeviceInfoGfxIpTable.h"), generate_gfx_ip_table_header(asic_types))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
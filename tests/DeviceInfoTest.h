@@ -0,0 +1,48 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Minimal checks shared by the device info tests.
+//==============================================================================
+
+#ifndef DEVICE_INFO_DEVICE_INFO_TEST_H_
+#define DEVICE_INFO_DEVICE_INFO_TEST_H_
+
+#include <cstdio>
+
+namespace DeviceInfoTest
+{
+    inline int gs_failureCount = 0; ///< Number of failed checks.
+
+    /// Record the result of a check, printing it if it failed.
+    /// \return the result of the check
+    inline bool Check(bool passed, const char *condition, const char *file, int line)
+    {
+        if (!passed)
+        {
+            ++gs_failureCount;
+            std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, condition);
+        }
+        return passed;
+    }
+
+    /// Print the summary of a test.
+    /// \param name the name of the test
+    /// \return the exit code of the test
+    inline int Finish(const char *name)
+    {
+        if (gs_failureCount != 0)
+        {
+            std::fprintf(stderr, "%s: %d checks failed\n", name, gs_failureCount);
+            return 1;
+        }
+
+        std::printf("%s: passed\n", name);
+        return 0;
+    }
+} // namespace DeviceInfoTest
+
+/// Check a condition and continue the test if it fails.
+#define DEVICE_INFO_CHECK(condition) DeviceInfoTest::Check(static_cast<bool>(condition), #condition, __FILE__, __LINE__)
+
+#endif
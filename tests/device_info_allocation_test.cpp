@@ -0,0 +1,320 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Checks that the lookups which do not fill a std::vector or std::string never allocate.
+///
+/// Global operator new is replaced to count allocations, and with glibc malloc is replaced as well, so allocations made
+/// by C code or by the standard library without operator new are counted too. Sanitizers intercept malloc themselves, so
+/// their builds only count operator new. Every lookup is made for every card in the card info table, once without a
+/// device name translator and once with a non-allocating one, and the test fails if anything was allocated.
+//==============================================================================
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string_view>
+#include <vector>
+
+#include "DeviceInfoGfxTarget.h"
+#include "DeviceInfoNameIndex.h"
+#include "DeviceInfoOverride.h"
+#include "DeviceInfoQuery.h"
+#include "DeviceInfoTest.h"
+#include "DeviceInfoUtils.h"
+#include "DeviceInfoVendor.h"
+
+#if defined(__SANITIZE_ADDRESS__) || defined(__SANITIZE_THREAD__)
+#define DEVICE_INFO_TEST_SANITIZER
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer) || __has_feature(thread_sanitizer) || __has_feature(memory_sanitizer)
+#define DEVICE_INFO_TEST_SANITIZER
+#endif
+#endif
+
+#if defined(__GLIBC__) && !defined(DEVICE_INFO_TEST_SANITIZER)
+#define DEVICE_INFO_TEST_COUNT_MALLOC
+#endif
+
+namespace
+{
+    std::atomic<bool>   gs_counting    = false; ///< True while the lookups run.
+    std::atomic<size_t> gs_newCount    = 0;     ///< Number of operator new calls while counting.
+    std::atomic<size_t> gs_mallocCount = 0;     ///< Number of malloc, calloc and realloc calls while counting.
+
+    void CountAllocation(std::atomic<size_t> &count)
+    {
+        if (gs_counting.load(std::memory_order_relaxed))
+        {
+            count.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+} // namespace
+
+void *operator new(size_t size)
+{
+    CountAllocation(gs_newCount);
+    if (void *memory = std::malloc(size == 0 ? 1 : size))
+    {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void *operator new(size_t size, std::align_val_t alignment)
+{
+    CountAllocation(gs_newCount);
+
+    // aligned_alloc needs the size to be a multiple of the alignment.
+    const size_t align = static_cast<size_t>(alignment);
+    if (void *memory = std::aligned_alloc(align, (size + align - 1) / align * align))
+    {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void *memory, size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void *memory, std::align_val_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void *memory, size_t, std::align_val_t) noexcept
+{
+    std::free(memory);
+}
+
+#ifdef DEVICE_INFO_TEST_COUNT_MALLOC
+// glibc allows replacing malloc, calloc, realloc and free, and exports its own implementations under these names.
+extern "C"
+{
+    void *__libc_malloc(size_t size);
+    void *__libc_calloc(size_t count, size_t size);
+    void *__libc_realloc(void *memory, size_t size);
+    void  __libc_free(void *memory);
+
+    void *malloc(size_t size) noexcept
+    {
+        CountAllocation(gs_mallocCount);
+        return __libc_malloc(size);
+    }
+
+    void *calloc(size_t count, size_t size) noexcept
+    {
+        CountAllocation(gs_mallocCount);
+        return __libc_calloc(count, size);
+    }
+
+    void *realloc(void *memory, size_t size) noexcept
+    {
+        CountAllocation(gs_mallocCount);
+        return __libc_realloc(memory, size);
+    }
+
+    void free(void *memory) noexcept
+    {
+        __libc_free(memory);
+    }
+}
+#endif
+
+namespace
+{
+    using AMDTDeviceInfoUtils::CardHandle;
+
+    constexpr GDT_HW_GENERATION kFamilies[] = {GDT_HW_GENERATION_SOUTHERNISLAND,
+                                               GDT_HW_GENERATION_SEAISLAND,
+                                               GDT_HW_GENERATION_VOLCANICISLAND,
+                                               GDT_HW_GENERATION_GFX9,
+                                               GDT_HW_GENERATION_GFX10,
+                                               GDT_HW_GENERATION_GFX11,
+                                               GDT_HW_GENERATION_GFX12}; ///< The generations IsXFamily is asked about.
+
+    /// A non-allocating translator, so the translated lookup paths are covered as well.
+    std::string_view TranslateView(std::string_view deviceName)
+    {
+        return deviceName;
+    }
+
+    /// The inputs of the batch lookups, built before counting starts.
+    struct Batches
+    {
+        std::vector<AMDTDeviceInfoUtils::DeviceQuery>        devices;
+        std::vector<AMDTDeviceInfoUtils::ResolvedDevice>     deviceResults;
+        std::vector<std::string_view>                        names;
+        std::vector<AMDTDeviceInfoUtils::ResolvedDeviceName> nameResults;
+    };
+
+    /// Make every single-card lookup for a card.
+    /// \return a checksum of the results, so the lookups cannot be optimized away
+    uint64_t LookUpCard(CardHandle handle)
+    {
+        const GDT_GfxCardInfo &card          = gs_cardInfo[handle];
+        const std::string_view calName       = card.m_szCALName;
+        const std::string_view marketingName = card.m_szMarketingName;
+        uint64_t               sum           = 0;
+
+        GDT_DeviceInfo    deviceInfo = {};
+        GDT_GfxCardInfo   cardInfo   = {};
+        GDT_HW_GENERATION generation = GDT_HW_GENERATION_NONE;
+        bool              flag       = false;
+        uint32_t          gfxIpVer   = 0;
+
+        // Lookups by device ID.
+        sum += AMDTDeviceInfoUtils::GetDeviceInfo(card.m_deviceID, card.m_revID, deviceInfo);
+        sum += AMDTDeviceInfoUtils::GetDeviceInfo(card.m_deviceID, AMDTDeviceInfoUtils::kRevisionIdAny, deviceInfo);
+        sum += AMDTDeviceInfoUtils::GetDeviceInfo(card.m_deviceID, card.m_revID, cardInfo);
+        sum += AMDTDeviceInfoUtils::IsAPU(card.m_deviceID, flag) + flag;
+        sum += AMDTDeviceInfoUtils::GetHardwareGeneration(card.m_deviceID, generation) + generation;
+        for (const GDT_HW_GENERATION family : kFamilies)
+        {
+            sum += AMDTDeviceInfoUtils::IsXFamily(card.m_deviceID, family, flag) + flag;
+        }
+        sum += AMDTDeviceInfoUtils::IsGfx12Family(card.m_deviceID, flag) + AMDTDeviceInfoUtils::IsGfx11Family(card.m_deviceID, flag) +
+               AMDTDeviceInfoUtils::IsGfx10Family(card.m_deviceID, flag) + AMDTDeviceInfoUtils::IsGfx9Family(card.m_deviceID, flag) +
+               AMDTDeviceInfoUtils::IsVIFamily(card.m_deviceID, flag) + AMDTDeviceInfoUtils::IsCIFamily(card.m_deviceID, flag) +
+               AMDTDeviceInfoUtils::IsSIFamily(card.m_deviceID, flag);
+        sum += AMDTDeviceInfoUtils::FindCardsByDeviceId(card.m_deviceID).size();
+
+        // Vendor-qualified lookups, including a vendor without a device table.
+        sum += AMDTDeviceInfoUtils::GetDeviceInfo(AMDTDeviceInfoUtils::kAmdVendorId, card.m_deviceID, card.m_revID, deviceInfo);
+        sum += AMDTDeviceInfoUtils::GetDeviceInfo(AMDTDeviceInfoUtils::kAmdVendorId, card.m_deviceID, card.m_revID, cardInfo);
+        sum += AMDTDeviceInfoUtils::GetDeviceInfo(AMDTDeviceInfoUtils::kNvidiaVendorId, card.m_deviceID, card.m_revID, deviceInfo);
+
+        // Lookups by CAL name, through both the NUL terminated and the string_view overloads.
+        sum += AMDTDeviceInfoUtils::GetDeviceInfo(card.m_szCALName, deviceInfo);
+        sum += AMDTDeviceInfoUtils::GetDeviceInfo(calName, deviceInfo);
+        sum += AMDTDeviceInfoUtils::IsAPU(card.m_szCALName, flag) + AMDTDeviceInfoUtils::IsAPU(calName, flag);
+        sum += AMDTDeviceInfoUtils::GetHardwareGeneration(card.m_szCALName, generation) + AMDTDeviceInfoUtils::GetHardwareGeneration(calName, generation);
+        sum += AMDTDeviceInfoUtils::IsXFamily(card.m_szCALName, card.m_generation, flag) + AMDTDeviceInfoUtils::IsXFamily(calName, card.m_generation, flag);
+        sum += AMDTDeviceInfoUtils::FindCardsByCalName(calName).size();
+
+        // Lookups by marketing name.
+        std::array<char, AMDTDeviceInfoUtils::kMaxNormalizedNameLength> normalized;
+        sum += AMDTDeviceInfoUtils::NormalizeMarketingName(marketingName, normalized).size();
+        sum += AMDTDeviceInfoUtils::FindCardsByMarketingName(marketingName).size();
+        sum += AMDTDeviceInfoUtils::CompleteMarketingName(marketingName.substr(0, marketingName.size() / 2)).size();
+
+        std::array<AMDTDeviceInfoUtils::CardMatch, 16> matches;
+        sum += AMDTDeviceInfoUtils::SearchCards(marketingName, matches);
+        sum += AMDTDeviceInfoUtils::SearchCards(calName, matches);
+        sum += AMDTDeviceInfoUtils::SearchCards(calName.substr(0, 2), matches);
+
+        // Gfx targets and graphics IP versions.
+        std::array<char, AMDTDeviceInfoUtils::kMaxGfxTargetLength> target;
+        if (const auto key = AMDTDeviceInfoUtils::ParseGfxTarget(calName); key.has_value())
+        {
+            sum += AMDTDeviceInfoUtils::FormatGfxTarget(*key, target).size();
+            sum += AMDTDeviceInfoUtils::FindCardsByGfxTarget(*key).size();
+        }
+        if (const auto version = AMDTDeviceInfoUtils::AsicTypeToGfxIpVersion(card.m_asicType); version.has_value())
+        {
+            sum += AMDTDeviceInfoUtils::FormatGfxTarget(*version, target).size();
+            sum += AMDTDeviceInfoUtils::GfxIpVersionToHwGeneration(*version);
+            sum += AMDTDeviceInfoUtils::GfxIpVersionToAsicTypes(*version).size();
+        }
+        sum += AMDTDeviceInfoUtils::HwGenerationToGfxIpVersion(card.m_generation).value_or(0);
+        sum += AMDTDeviceInfoUtils::HwGenerationToGfxIPVer(card.m_generation, gfxIpVer) + gfxIpVer;
+        sum += AMDTDeviceInfoUtils::GfxIPVerToHwGeneration(gfxIpVer, generation) + generation;
+        sum += AMDTDeviceInfoUtils::GetHardwareGenerationDisplayName(card.m_generation).size();
+
+        // Device info and card sets.
+        const GDT_DeviceInfo &cardDeviceInfo = AMDTDeviceInfoUtils::GetCardDeviceInfo(handle);
+        sum += AMDTDeviceInfoUtils::GetTotalLdsSizeInBytes(card.m_generation, cardDeviceInfo).value_or(0);
+        sum += AMDTDeviceInfoUtils::CardsInHardwareGeneration(card.m_generation).Count();
+        sum += AMDTDeviceInfoUtils::CardsWithAsicType(card.m_asicType).Count();
+        sum += AMDTDeviceInfoUtils::CardsWithWaveSize(cardDeviceInfo.m_nWaveSize).Count();
+        sum += AMDTDeviceInfoUtils::CardsWithShaderEngineCount(cardDeviceInfo.m_nNumShaderEngines).Count();
+        sum += (AMDTDeviceInfoUtils::CardsWithMinCUs(cardDeviceInfo.m_nNumCUs) & AMDTDeviceInfoUtils::CardsWithMaxCUs(cardDeviceInfo.m_nNumCUs)).Count();
+        sum += (AMDTDeviceInfoUtils::AllCards() - AMDTDeviceInfoUtils::ApuCards()).Count();
+
+        const AMDTDeviceInfoUtils::HardwareConfig config = {cardDeviceInfo.m_nNumCUs, cardDeviceInfo.m_nNumShaderEngines, cardDeviceInfo.m_nNumSHPerSE, cardDeviceInfo.m_nWaveSize};
+        std::array<AMDTDeviceInfoUtils::AsicConfigMatch, 4> nearest;
+        sum += AMDTDeviceInfoUtils::AsicTypesWithConfig(config).size();
+        sum += AMDTDeviceInfoUtils::CardsWithConfig(config).Count();
+        sum += AMDTDeviceInfoUtils::FindNearestAsicTypes(config, nearest);
+
+        return sum;
+    }
+
+    /// Make every lookup for every card, and the batch lookups over all of them.
+    /// \return a checksum of the results
+    uint64_t LookUpAllCards(Batches &batches)
+    {
+        uint64_t sum = 0;
+        for (size_t card = 0; card < gs_cardInfo.size(); ++card)
+        {
+            sum += LookUpCard(static_cast<CardHandle>(card));
+        }
+
+        sum += AMDTDeviceInfoUtils::ResolveDevices(batches.devices, batches.deviceResults);
+        sum += AMDTDeviceInfoUtils::ResolveDeviceNames(batches.names, batches.nameResults);
+
+        // Names and device IDs that are not in the table.
+        GDT_DeviceInfo deviceInfo = {};
+        sum += AMDTDeviceInfoUtils::GetDeviceInfo(0xFFFFu, AMDTDeviceInfoUtils::kRevisionIdAny, deviceInfo);
+        sum += AMDTDeviceInfoUtils::GetDeviceInfo(std::string_view("not a device"), deviceInfo);
+        sum += AMDTDeviceInfoUtils::FindCardsByMarketingName("not a device").size();
+        return sum;
+    }
+} // namespace
+
+int main()
+{
+    // Exercise the overridden device info as well.
+    AMDTDeviceInfoUtils::DeviceInfoOverride override;
+    override.deviceID = gs_cardInfo.front().m_deviceID;
+    override.numCUs   = 1;
+    DEVICE_INFO_CHECK(AMDTDeviceInfoUtils::SetDeviceInfoOverrides({&override, 1}) != 0);
+
+    Batches batches;
+    for (const GDT_GfxCardInfo &card : gs_cardInfo)
+    {
+        batches.devices.push_back({AMDTDeviceInfoUtils::kAmdVendorId, card.m_deviceID, card.m_revID});
+        batches.names.push_back(card.m_szCALName);
+        batches.names.push_back(card.m_szMarketingName);
+    }
+    batches.deviceResults.resize(batches.devices.size());
+    batches.nameResults.resize(batches.names.size());
+
+    // Print once before counting, so the output buffer is allocated already.
+    std::printf("device_info_allocation_test: looking up %zu cards\n", gs_cardInfo.size());
+
+    uint64_t sum = 0;
+    for (const AMDTDeviceInfoUtils::DeviceNameViewTranslatorFunction translator : {AMDTDeviceInfoUtils::DeviceNameViewTranslatorFunction{nullptr}, &TranslateView})
+    {
+        AMDTDeviceInfoUtils::SetDeviceNameViewTranslator(translator);
+
+        gs_counting.store(true, std::memory_order_relaxed);
+        sum += LookUpAllCards(batches);
+        gs_counting.store(false, std::memory_order_relaxed);
+
+        const char *mode = (nullptr == translator) ? "without a translator" : "with a view translator";
+        std::printf("%s: %zu operator new calls, %zu malloc calls\n", mode, gs_newCount.load(), gs_mallocCount.load());
+        DEVICE_INFO_CHECK(gs_newCount.load() == 0);
+        DEVICE_INFO_CHECK(gs_mallocCount.load() == 0);
+        gs_newCount    = 0;
+        gs_mallocCount = 0;
+    }
+    AMDTDeviceInfoUtils::SetDeviceNameViewTranslator(nullptr);
+
+#ifndef DEVICE_INFO_TEST_COUNT_MALLOC
+    std::puts("malloc is not counted in this build");
+#endif
+
+    std::printf("checksum %llu\n", static_cast<unsigned long long>(sum));
+    return DeviceInfoTest::Finish("device_info_allocation_test");
+}
@@ -0,0 +1,189 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Checks that every public lookup overload records a miss with its API and key.
+//==============================================================================
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstdio>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "DeviceInfoMisses.h"
+#include "DeviceInfoNameIndex.h"
+#include "DeviceInfoTest.h"
+#include "DeviceInfoUtils.h"
+#include "DeviceInfoVendor.h"
+
+namespace
+{
+    using AMDTDeviceInfoUtils::LookupMiss;
+    using AMDTDeviceInfoUtils::LookupTraceApi;
+
+    constexpr uint32_t         kUnknownDeviceId = 0xFFFF;             ///< A device ID no card has.
+    constexpr uint32_t         kUnknownRevision = 0xEE;               ///< A revision ID no card has.
+    constexpr const char      *kUnknownName     = "NoSuchDevice";     ///< A name no card has.
+    constexpr std::string_view kUnknownNameView = "NoSuchDeviceView"; ///< A name no card has, passed as a string_view.
+
+    /// Drain the misses recorded since the last call.
+    std::vector<LookupMiss> DrainMisses()
+    {
+        std::vector<LookupMiss>    drained;
+        std::array<LookupMiss, 16> misses;
+        while (const size_t count = AMDTDeviceInfoUtils::DrainLookupMisses(misses))
+        {
+            drained.insert(drained.end(), misses.begin(), misses.begin() + count);
+        }
+        return drained;
+    }
+
+    /// Check that a lookup by device ID recorded exactly one miss.
+    void CheckDeviceIdMiss(const char *overload, LookupTraceApi api, uint32_t vendorID, uint32_t deviceID, uint32_t revisionID)
+    {
+        const std::vector<LookupMiss> misses = DrainMisses();
+        if (!DEVICE_INFO_CHECK(misses.size() == 1))
+        {
+            std::fprintf(stderr, "  %s recorded %zu misses\n", overload, misses.size());
+            return;
+        }
+
+        const LookupMiss &miss = misses.front();
+        if (!DEVICE_INFO_CHECK(miss.api == api && miss.vendorID == vendorID && miss.deviceID == deviceID && miss.revisionID == revisionID &&
+                               miss.nameLength == 0))
+        {
+            std::fprintf(stderr, "  %s recorded api %d, 0x%x 0x%x 0x%x\n", overload, static_cast<int>(miss.api), miss.vendorID, miss.deviceID, miss.revisionID);
+        }
+    }
+
+    /// Check that a lookup by name recorded exactly one miss.
+    void CheckNameMiss(const char *overload, LookupTraceApi api, std::string_view name)
+    {
+        const std::vector<LookupMiss> misses = DrainMisses();
+        if (!DEVICE_INFO_CHECK(misses.size() == 1))
+        {
+            std::fprintf(stderr, "  %s recorded %zu misses\n", overload, misses.size());
+            return;
+        }
+
+        const LookupMiss &miss = misses.front();
+        if (!DEVICE_INFO_CHECK(miss.api == api && miss.Name() == name && miss.deviceID == 0))
+        {
+            std::fprintf(stderr, "  %s recorded api %d, '%.*s'\n", overload, static_cast<int>(miss.api), static_cast<int>(miss.nameLength), miss.name.data());
+        }
+    }
+} // namespace
+
+int main()
+{
+    using AMDTDeviceInfoUtils::kAmdVendorId;
+    using AMDTDeviceInfoUtils::kNvidiaVendorId;
+    using AMDTDeviceInfoUtils::kRevisionIdAny;
+
+    AMDTDeviceInfoUtils::SetLookupMissRecording(true);
+    static_cast<void>(DrainMisses());
+
+    GDT_DeviceInfo               deviceInfo = {};
+    GDT_GfxCardInfo              cardInfo   = {};
+    std::vector<GDT_GfxCardInfo> cardList;
+    GDT_HW_GENERATION            generation = GDT_HW_GENERATION_NONE;
+    bool                         flag       = false;
+
+    // Lookups by device ID.
+    DEVICE_INFO_CHECK(!AMDTDeviceInfoUtils::GetDeviceInfo(kUnknownDeviceId, kUnknownRevision, deviceInfo));
+    CheckDeviceIdMiss("GetDeviceInfo(deviceID, GDT_DeviceInfo)", LookupTraceApi::kDeviceId, kAmdVendorId, kUnknownDeviceId, kUnknownRevision);
+
+    DEVICE_INFO_CHECK(!AMDTDeviceInfoUtils::GetDeviceInfo(kUnknownDeviceId, kRevisionIdAny, cardInfo));
+    CheckDeviceIdMiss("GetDeviceInfo(deviceID, GDT_GfxCardInfo)", LookupTraceApi::kDeviceId, kAmdVendorId, kUnknownDeviceId, kRevisionIdAny);
+
+    DEVICE_INFO_CHECK(!AMDTDeviceInfoUtils::GetAllCardsWithDeviceId(kUnknownDeviceId, cardList));
+    CheckDeviceIdMiss("GetAllCardsWithDeviceId", LookupTraceApi::kDeviceId, kAmdVendorId, kUnknownDeviceId, kRevisionIdAny);
+
+    // IsAPU(deviceID) and GetHardwareGeneration(deviceID) keep the baseline scan, which matches the first card with a different
+    // device ID, so an unknown device ID is never a miss for them and they are not checked here.
+
+    // Vendor-qualified lookups, of a known and an unknown vendor.
+    DEVICE_INFO_CHECK(!AMDTDeviceInfoUtils::GetDeviceInfo(kAmdVendorId, kUnknownDeviceId, kUnknownRevision, deviceInfo));
+    CheckDeviceIdMiss("GetDeviceInfo(vendorID, GDT_DeviceInfo)", LookupTraceApi::kDeviceId, kAmdVendorId, kUnknownDeviceId, kUnknownRevision);
+
+    DEVICE_INFO_CHECK(!AMDTDeviceInfoUtils::GetDeviceInfo(kNvidiaVendorId, kUnknownDeviceId, kUnknownRevision, cardInfo));
+    CheckDeviceIdMiss("GetDeviceInfo(vendorID, GDT_GfxCardInfo)", LookupTraceApi::kDeviceId, kNvidiaVendorId, kUnknownDeviceId, kUnknownRevision);
+
+    const AMDTDeviceInfoUtils::DeviceQuery query = {kAmdVendorId, kUnknownDeviceId, kUnknownRevision};
+    AMDTDeviceInfoUtils::ResolvedDevice    resolved;
+    DEVICE_INFO_CHECK(AMDTDeviceInfoUtils::ResolveDevices({&query, 1}, {&resolved, 1}) == 0);
+    CheckDeviceIdMiss("ResolveDevices", LookupTraceApi::kResolveDevices, kAmdVendorId, kUnknownDeviceId, kUnknownRevision);
+
+    // Lookups by CAL name, through the NUL terminated and the string_view overloads.
+    DEVICE_INFO_CHECK(!AMDTDeviceInfoUtils::GetDeviceInfo(kUnknownName, deviceInfo));
+    CheckNameMiss("GetDeviceInfo(const char *, GDT_DeviceInfo)", LookupTraceApi::kCalName, kUnknownName);
+
+    DEVICE_INFO_CHECK(!AMDTDeviceInfoUtils::GetDeviceInfo(kUnknownNameView, deviceInfo));
+    CheckNameMiss("GetDeviceInfo(string_view, GDT_DeviceInfo)", LookupTraceApi::kCalName, kUnknownNameView);
+
+    DEVICE_INFO_CHECK(!AMDTDeviceInfoUtils::GetDeviceInfo(kUnknownName, cardList));
+    CheckNameMiss("GetDeviceInfo(const char *, vector)", LookupTraceApi::kCalName, kUnknownName);
+
+    DEVICE_INFO_CHECK(!AMDTDeviceInfoUtils::GetDeviceInfo(kUnknownNameView, cardList));
+    CheckNameMiss("GetDeviceInfo(string_view, vector)", LookupTraceApi::kCalName, kUnknownNameView);
+
+    DEVICE_INFO_CHECK(!AMDTDeviceInfoUtils::GetAllCardsWithName(kUnknownName, cardList));
+    CheckNameMiss("GetAllCardsWithName(const char *)", LookupTraceApi::kCalName, kUnknownName);
+
+    DEVICE_INFO_CHECK(!AMDTDeviceInfoUtils::GetAllCardsWithName(kUnknownNameView, cardList));
+    CheckNameMiss("GetAllCardsWithName(string_view)", LookupTraceApi::kCalName, kUnknownNameView);
+
+    DEVICE_INFO_CHECK(!AMDTDeviceInfoUtils::IsAPU(kUnknownName, flag));
+    CheckNameMiss("IsAPU(const char *)", LookupTraceApi::kCalName, kUnknownName);
+
+    DEVICE_INFO_CHECK(!AMDTDeviceInfoUtils::IsAPU(kUnknownNameView, flag));
+    CheckNameMiss("IsAPU(string_view)", LookupTraceApi::kCalName, kUnknownNameView);
+
+    DEVICE_INFO_CHECK(!AMDTDeviceInfoUtils::GetHardwareGeneration(kUnknownName, generation));
+    CheckNameMiss("GetHardwareGeneration(const char *)", LookupTraceApi::kCalName, kUnknownName);
+
+    DEVICE_INFO_CHECK(!AMDTDeviceInfoUtils::GetHardwareGeneration(kUnknownNameView, generation));
+    CheckNameMiss("GetHardwareGeneration(string_view)", LookupTraceApi::kCalName, kUnknownNameView);
+
+    DEVICE_INFO_CHECK(!AMDTDeviceInfoUtils::IsGfx11Family(kUnknownNameView, flag));
+    CheckNameMiss("IsGfx11Family(string_view)", LookupTraceApi::kCalName, kUnknownNameView);
+
+    const std::string_view                  name = kUnknownNameView;
+    AMDTDeviceInfoUtils::ResolvedDeviceName resolvedName;
+    DEVICE_INFO_CHECK(AMDTDeviceInfoUtils::ResolveDeviceNames({&name, 1}, {&resolvedName, 1}) == 0);
+    CheckNameMiss("ResolveDeviceNames", LookupTraceApi::kResolveDeviceNames, kUnknownNameView);
+
+    // Lookups by marketing name.
+    DEVICE_INFO_CHECK(AMDTDeviceInfoUtils::FindCardsByMarketingName(kUnknownNameView).empty());
+    CheckNameMiss("FindCardsByMarketingName", LookupTraceApi::kMarketingName, kUnknownNameView);
+
+    DEVICE_INFO_CHECK(!AMDTDeviceInfoUtils::GetDeviceInfoMarketingName(kUnknownName, cardList));
+    CheckNameMiss("GetDeviceInfoMarketingName(const char *)", LookupTraceApi::kMarketingName, kUnknownName);
+
+    // A name that only matches after normalization is found by FindCardsByMarketingName, but not by the exact comparison.
+    std::string upperCaseName = gs_cardInfo.front().m_szMarketingName;
+    std::ranges::transform(upperCaseName, upperCaseName.begin(), [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
+    DEVICE_INFO_CHECK(!AMDTDeviceInfoUtils::FindCardsByMarketingName(upperCaseName).empty());
+    static_cast<void>(DrainMisses());
+    DEVICE_INFO_CHECK(!AMDTDeviceInfoUtils::GetDeviceInfoMarketingName(std::string_view(upperCaseName), cardList));
+    CheckNameMiss("GetDeviceInfoMarketingName(string_view)", LookupTraceApi::kMarketingName, upperCaseName);
+
+    // Lookups that find a device record nothing.
+    const GDT_GfxCardInfo &known = gs_cardInfo.front();
+    DEVICE_INFO_CHECK(AMDTDeviceInfoUtils::GetDeviceInfo(known.m_deviceID, known.m_revID, deviceInfo));
+    DEVICE_INFO_CHECK(AMDTDeviceInfoUtils::GetAllCardsWithDeviceId(known.m_deviceID, cardList));
+    DEVICE_INFO_CHECK(AMDTDeviceInfoUtils::IsAPU(known.m_szCALName, flag));
+    DEVICE_INFO_CHECK(AMDTDeviceInfoUtils::GetDeviceInfoMarketingName(known.m_szMarketingName, cardList));
+    DEVICE_INFO_CHECK(DrainMisses().empty());
+
+    AMDTDeviceInfoUtils::SetLookupMissRecording(false);
+    DEVICE_INFO_CHECK(!AMDTDeviceInfoUtils::GetDeviceInfo(kUnknownDeviceId, kRevisionIdAny, deviceInfo));
+    DEVICE_INFO_CHECK(DrainMisses().empty());
+    DEVICE_INFO_CHECK(AMDTDeviceInfoUtils::TakeDroppedLookupMissCount() == 0);
+
+    return DeviceInfoTest::Finish("device_info_miss_test");
+}
@@ -0,0 +1,38 @@
+## Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved. ##
+
+# Runs device_info_resolve on input with valid, unknown, malformed, CRLF and blank lines, read from a file and from stdin, and
+# compares its output with the expected output of the format.
+# Usage: cmake -DRESOLVE=<tool> -DFORMAT=tsv|ndjson -DEXPECTED=<file> -DWORK_DIR=<dir> -P device_info_resolve_test.cmake
+
+set(input "${WORK_DIR}/device_info_resolve_input_${FORMAT}.txt")
+file(WRITE ${input}
+    "1002:73bf:c0\n"
+    "0x1002:0x73BF\n"
+    "1002:73bf:ee\n"
+    "1002:ffff\n"
+    "10de:2204:a1\n"
+    "not a device\n"
+    "1002:73bf:zz\n"
+    "bad\t\"line\"\n"
+    "\n"
+    "1002:73bf:c0\r\n"
+    "   \r\n"
+    "1002:73bf:41"
+)
+
+foreach (source file stdin)
+    set(output "${WORK_DIR}/device_info_resolve_output_${FORMAT}_${source}")
+    if (source STREQUAL "file")
+        execute_process(COMMAND ${RESOLVE} --format ${FORMAT} --threads 2 ${input} OUTPUT_FILE ${output} RESULT_VARIABLE result)
+    else()
+        execute_process(COMMAND ${RESOLVE} --format ${FORMAT} --threads 2 INPUT_FILE ${input} OUTPUT_FILE ${output} RESULT_VARIABLE result)
+    endif()
+    if (NOT result EQUAL 0)
+        message(FATAL_ERROR "device_info_resolve failed reading from ${source}: ${result}")
+    endif()
+
+    execute_process(COMMAND ${CMAKE_COMMAND} -E compare_files ${EXPECTED} ${output} RESULT_VARIABLE result)
+    if (NOT result EQUAL 0)
+        message(FATAL_ERROR "The output of device_info_resolve reading from ${source} differs from ${EXPECTED}, see ${output}")
+    endif()
+endforeach()
@@ -0,0 +1,273 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Runs lookups on many threads while other threads replace the runtime state the lookups read.
+///
+/// Usage: device_info_stress_test [THREADS [UPDATES]]
+///
+/// THREADS lookup threads (4 by default) look up every card by device ID, CAL name and vendor, in batches and one by one,
+/// repeating recent keys so the lookup cache is hit when it is enabled. At the same time one thread each keeps replacing
+/// the device name translator, the device info overrides and a vendor backend, UPDATES times (50 by default), which
+/// invalidates the lookup caches every time. Every result is checked against the states that may be published, and the
+/// lookups per second of every thread are printed. Build it with the tsan or asan preset to check the synchronization.
+//==============================================================================
+
+#include <array>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "DeviceInfoNameIndex.h"
+#include "DeviceInfoOverride.h"
+#include "DeviceInfoTest.h"
+#include "DeviceInfoUtils.h"
+#include "DeviceInfoVendor.h"
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr unsigned         kDefaultThreadCount = 4;                                   ///< Number of lookup threads if none is specified.
+    constexpr unsigned         kDefaultUpdateCount = 50;                                  ///< Number of updates of every kind if none is specified.
+    constexpr size_t           kBatchSize          = 16;                                  ///< Number of devices or names per batch lookup.
+    constexpr size_t           kRecentKeyCount     = 4;                                   ///< Number of keys looked up repeatedly, to hit the lookup cache.
+    constexpr uint8_t          kOverriddenCUs      = 1;                                   ///< Number of CUs set by the overrides, which no ASIC type has.
+    constexpr std::string_view kAliasName          = "StressAliasName";                   ///< A name that only the translator knows.
+    constexpr uint32_t         kBackendVendorId    = AMDTDeviceInfoUtils::kIntelVendorId; ///< Vendor ID of the vendor backend that is registered and unregistered.
+
+    /// The cards of the vendor backend. The device info is filled in before the backend is first registered.
+    constexpr GDT_GfxCardInfo kBackendCards[] = {
+        {GDT_ASIC_TYPE_NONE, 0x56A0, 0x08, GDT_HW_GENERATION_NONE, false, "stress0", "Stress GPU 0"},
+        {GDT_ASIC_TYPE_NONE, 0x56A1, 0x08, GDT_HW_GENERATION_NONE, false, "stress1", "Stress GPU 1"},
+    };
+
+    GDT_DeviceInfo gs_backendDeviceInfo[std::size(kBackendCards)] = {}; ///< The device info of the cards of the vendor backend.
+
+    std::atomic<bool>   gs_stop         = false; ///< Set when the updating threads are done.
+    std::atomic<size_t> gs_inconsistent = 0;     ///< Number of lookup results that match none of the published states.
+
+    /// Translates kAliasName to the CAL name of the first card, and every other name to itself.
+    std::string TranslateAlias(const char *deviceName)
+    {
+        return (kAliasName == deviceName) ? std::string(gs_cardInfo.front().m_szCALName) : std::string(deviceName);
+    }
+
+    /// Record a result that matches none of the published states.
+    void CheckConsistent(bool isConsistent)
+    {
+        if (!isConsistent)
+        {
+            gs_inconsistent.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    /// Check the device info of an AMD card, which is either the device info of its ASIC type or overridden.
+    void CheckAmdDeviceInfo(const GDT_GfxCardInfo &card, const GDT_DeviceInfo &deviceInfo)
+    {
+        const GDT_DeviceInfo &asicDeviceInfo = GetDeviceInfoForAsicType(card.m_asicType);
+        CheckConsistent(deviceInfo.m_nNumCUs == asicDeviceInfo.m_nNumCUs || deviceInfo.m_nNumCUs == kOverriddenCUs);
+        CheckConsistent(deviceInfo.m_nNumShaderEngines == asicDeviceInfo.m_nNumShaderEngines);
+    }
+
+    /// Look up cards until the updating threads are done.
+    /// \param thread the index of the thread, so the threads start at different cards
+    /// \return the number of lookups made
+    size_t RunLookups(size_t thread)
+    {
+        std::vector<AMDTDeviceInfoUtils::DeviceQuery>        devices(kBatchSize);
+        std::vector<AMDTDeviceInfoUtils::ResolvedDevice>     deviceResults(kBatchSize);
+        std::vector<std::string_view>                        names(kBatchSize);
+        std::vector<AMDTDeviceInfoUtils::ResolvedDeviceName> nameResults(kBatchSize);
+
+        size_t lookups = 0;
+        size_t next    = thread * 97;
+        while (!gs_stop.load(std::memory_order_relaxed))
+        {
+            for (size_t i = 0; i < kBatchSize; ++i)
+            {
+                // Every other key is one of a few recent ones, which the lookup cache keeps.
+                const size_t           handle = ((i % 2) == 0) ? (next + i) % gs_cardInfo.size() : (i / 2) % kRecentKeyCount;
+                const GDT_GfxCardInfo &card   = gs_cardInfo[handle];
+                GDT_DeviceInfo         deviceInfo;
+
+                const bool byDeviceId = AMDTDeviceInfoUtils::GetDeviceInfo(card.m_deviceID, card.m_revID, deviceInfo);
+                CheckConsistent(byDeviceId);
+                if (byDeviceId)
+                {
+                    CheckAmdDeviceInfo(card, deviceInfo);
+                }
+
+                const bool byCalName = AMDTDeviceInfoUtils::GetDeviceInfo(std::string_view(card.m_szCALName), deviceInfo);
+                CheckConsistent(byCalName);
+
+                bool isAPU = false;
+                CheckConsistent(AMDTDeviceInfoUtils::IsAPU(card.m_szCALName, isAPU));
+                CheckAmdDeviceInfo(card, AMDTDeviceInfoUtils::GetCardDeviceInfo(static_cast<AMDTDeviceInfoUtils::CardHandle>(handle)));
+
+                const GDT_GfxCardInfo &backendCard = kBackendCards[i % std::size(kBackendCards)];
+                if (AMDTDeviceInfoUtils::GetDeviceInfo(kBackendVendorId, backendCard.m_deviceID, backendCard.m_revID, deviceInfo))
+                {
+                    CheckConsistent(deviceInfo.m_nNumCUs == gs_backendDeviceInfo[i % std::size(kBackendCards)].m_nNumCUs);
+                }
+
+                // The alias is only found while the translator is installed, but then it is always the first card.
+                GDT_HW_GENERATION generation = GDT_HW_GENERATION_NONE;
+                if (AMDTDeviceInfoUtils::GetHardwareGeneration(kAliasName, generation))
+                {
+                    CheckConsistent(generation == gs_cardInfo.front().m_generation);
+                }
+
+                // Batches mix AMD cards, cards of the vendor backend and the alias.
+                devices[i] = ((i % 3) == 0) ? AMDTDeviceInfoUtils::DeviceQuery{kBackendVendorId, backendCard.m_deviceID, backendCard.m_revID}
+                                            : AMDTDeviceInfoUtils::DeviceQuery{AMDTDeviceInfoUtils::kAmdVendorId, card.m_deviceID, card.m_revID};
+                names[i]   = ((i % 4) == 0) ? kAliasName : std::string_view(card.m_szCALName);
+            }
+
+            AMDTDeviceInfoUtils::ResolveDevices(devices, deviceResults);
+            for (size_t i = 0; i < kBatchSize; ++i)
+            {
+                if (devices[i].vendorID == AMDTDeviceInfoUtils::kAmdVendorId)
+                {
+                    CheckConsistent(nullptr != deviceResults[i].cardInfo);
+                }
+                if (nullptr != deviceResults[i].cardInfo)
+                {
+                    CheckConsistent(deviceResults[i].cardInfo->m_deviceID == devices[i].deviceID);
+                }
+            }
+
+            AMDTDeviceInfoUtils::ResolveDeviceNames(names, nameResults);
+            for (size_t i = 0; i < kBatchSize; ++i)
+            {
+                if (names[i] != kAliasName)
+                {
+                    CheckConsistent(!nameResults[i].cards.empty());
+                }
+            }
+
+            // Six lookups per key, and one per key of each batch.
+            lookups += kBatchSize * 8;
+            next += kBatchSize;
+        }
+
+        return lookups;
+    }
+
+    /// Install and remove the translator.
+    void UpdateTranslator(unsigned updateCount)
+    {
+        for (unsigned i = 0; i < updateCount; ++i)
+        {
+            AMDTDeviceInfoUtils::SetDeviceNameTranslator(((i % 2) == 0) ? &TranslateAlias : nullptr);
+            std::this_thread::yield();
+        }
+        AMDTDeviceInfoUtils::SetDeviceNameTranslator(nullptr);
+    }
+
+    /// Replace the overrides with ones for an alternating half of the cards, and finally remove them.
+    void UpdateOverrides(unsigned updateCount)
+    {
+        std::vector<AMDTDeviceInfoUtils::DeviceInfoOverride> overrides;
+        for (unsigned i = 0; i < updateCount; ++i)
+        {
+            overrides.clear();
+            for (size_t card = i % 2; card < gs_cardInfo.size(); card += 2)
+            {
+                AMDTDeviceInfoUtils::DeviceInfoOverride override;
+                override.deviceID   = gs_cardInfo[card].m_deviceID;
+                override.revisionID = gs_cardInfo[card].m_revID;
+                override.numCUs     = kOverriddenCUs;
+                overrides.push_back(override);
+            }
+            static_cast<void>(AMDTDeviceInfoUtils::SetDeviceInfoOverrides(overrides));
+            std::this_thread::yield();
+        }
+        static_cast<void>(AMDTDeviceInfoUtils::SetDeviceInfoOverrides({}));
+    }
+
+    /// Register and unregister the vendor backend.
+    void UpdateBackend(unsigned updateCount)
+    {
+        for (unsigned i = 0; i < updateCount; ++i)
+        {
+            if ((i % 2) == 0)
+            {
+                CheckConsistent(AMDTDeviceInfoUtils::RegisterVendorBackend({kBackendVendorId, kBackendCards, gs_backendDeviceInfo}));
+            }
+            else
+            {
+                AMDTDeviceInfoUtils::UnregisterVendorBackend(kBackendVendorId);
+            }
+            std::this_thread::yield();
+        }
+        AMDTDeviceInfoUtils::UnregisterVendorBackend(kBackendVendorId);
+    }
+
+    /// Parse a positive number argument.
+    /// \return the number, or 0 if the argument is not a positive number
+    unsigned ParseCount(std::string_view text)
+    {
+        unsigned   value  = 0;
+        const auto result = std::from_chars(text.data(), text.data() + text.size(), value);
+        return (result.ec == std::errc() && result.ptr == text.data() + text.size()) ? value : 0;
+    }
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    const unsigned threadCount = (argc > 1) ? ParseCount(argv[1]) : kDefaultThreadCount;
+    const unsigned updateCount = (argc > 2) ? ParseCount(argv[2]) : kDefaultUpdateCount;
+    if (argc > 3 || threadCount == 0 || updateCount == 0)
+    {
+        std::fputs("Usage: device_info_stress_test [THREADS [UPDATES]]\n", stderr);
+        return 2;
+    }
+
+    for (size_t i = 0; i < std::size(kBackendCards); ++i)
+    {
+        gs_backendDeviceInfo[i]           = GetDeviceInfoForAsicType(gs_cardInfo[i].m_asicType);
+        gs_backendDeviceInfo[i].m_nNumCUs = static_cast<uint8_t>(2 + i);
+    }
+
+    std::vector<size_t>      lookups(threadCount);
+    std::vector<std::thread> lookupThreads;
+    const auto               start = Clock::now();
+    for (unsigned thread = 0; thread < threadCount; ++thread)
+    {
+        lookupThreads.emplace_back([&lookups, thread] { lookups[thread] = RunLookups(thread); });
+    }
+
+    std::array<std::thread, 3> updateThreads = {std::thread(UpdateTranslator, updateCount),
+                                                std::thread(UpdateOverrides, updateCount),
+                                                std::thread(UpdateBackend, updateCount)};
+    for (std::thread &thread : updateThreads)
+    {
+        thread.join();
+    }
+
+    gs_stop.store(true, std::memory_order_relaxed);
+    for (std::thread &thread : lookupThreads)
+    {
+        thread.join();
+    }
+    const std::chrono::duration<double> elapsed = Clock::now() - start;
+
+    // No lookup runs any more, so the retired backend indexes and overrides can be freed.
+    AMDTDeviceInfoUtils::ReleaseRetiredVendorBackends();
+    AMDTDeviceInfoUtils::ReleaseRetiredDeviceInfoOverrides();
+
+    for (unsigned thread = 0; thread < threadCount; ++thread)
+    {
+        std::printf("thread %u: %zu lookups, %.0f lookups/s\n", thread, lookups[thread], static_cast<double>(lookups[thread]) / elapsed.count());
+    }
+
+    DEVICE_INFO_CHECK(gs_inconsistent.load() == 0);
+    return DeviceInfoTest::Finish("device_info_stress_test");
+}
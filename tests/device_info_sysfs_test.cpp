@@ -0,0 +1,165 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Tests SysfsGpuEnumerator against a fake sysfs tree.
+//==============================================================================
+
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+
+#include "DeviceInfoSysfs.h"
+#include "DeviceInfoTest.h"
+#include "DeviceInfoVendor.h"
+
+namespace
+{
+    namespace fs = std::filesystem;
+
+    constexpr uint32_t kDisplayClass = 0x030000; ///< PCI class of a VGA compatible display controller.
+    constexpr uint32_t kAudioClass   = 0x040300; ///< PCI class of an HD audio controller, such as the one on a graphics card.
+
+    /// A temporary sysfs tree, removed when the test ends.
+    class FakeSysfs
+    {
+    public:
+        FakeSysfs()
+        {
+            std::string pattern = (fs::temp_directory_path() / "device_info_sysfs_XXXXXX").string();
+            if (nullptr != mkdtemp(pattern.data()))
+            {
+                m_root = pattern;
+                fs::create_directories(DevicesPath());
+                fs::create_directories(m_root / "devices" / "pci0000:00");
+            }
+        }
+
+        FakeSysfs(const FakeSysfs &)            = delete;
+        FakeSysfs &operator=(const FakeSysfs &) = delete;
+
+        ~FakeSysfs()
+        {
+            std::error_code error;
+            fs::remove_all(m_root, error);
+        }
+
+        [[nodiscard]] const fs::path &Root() const
+        {
+            return m_root;
+        }
+
+        [[nodiscard]] fs::path DevicesPath() const
+        {
+            return m_root / "bus" / "pci" / "devices";
+        }
+
+        /// Add a PCI device. Like in the real sysfs, the device directory is a symlink into the device hierarchy.
+        /// \param revisionID the revision ID, std::nullopt to leave the attribute out
+        void AddDevice(const std::string &address, uint32_t pciClass, uint32_t vendorID, uint32_t deviceID, std::optional<uint32_t> revisionID)
+        {
+            const fs::path device = m_root / "devices" / "pci0000:00" / address;
+            fs::create_directories(device);
+            WriteHex(device / "class", pciClass, 6);
+            WriteHex(device / "vendor", vendorID, 4);
+            WriteHex(device / "device", deviceID, 4);
+            if (revisionID.has_value())
+            {
+                WriteHex(device / "revision", *revisionID, 2);
+            }
+            fs::create_directory_symlink(device, DevicesPath() / address);
+        }
+
+        /// Set the modification time of the PCI device directory, so a change is seen even within the timestamp granularity.
+        void SetDevicesMtime(time_t seconds)
+        {
+            const timespec times[2] = {{seconds, 0}, {seconds, 0}};
+            utimensat(AT_FDCWD, DevicesPath().c_str(), times, 0);
+        }
+
+        /// Overwrite an attribute of a device without touching the PCI device directory.
+        void RewriteAttribute(const std::string &address, const char *name, uint32_t value)
+        {
+            WriteHex(m_root / "devices" / "pci0000:00" / address / name, value, 4);
+        }
+
+    private:
+        /// Write a sysfs style hexadecimal attribute, e.g. "0x1002\n".
+        static void WriteHex(const fs::path &path, uint32_t value, int digits)
+        {
+            std::ofstream file(path, std::ios::trunc);
+            char          text[16];
+            std::snprintf(text, sizeof(text), "0x%0*x\n", digits, value);
+            file << text;
+        }
+
+        fs::path m_root; ///< The root of the tree, empty if it could not be created.
+    };
+} // namespace
+
+int main()
+{
+    using AMDTDeviceInfoUtils::kAmdVendorId;
+    using AMDTDeviceInfoUtils::kNvidiaVendorId;
+
+    FakeSysfs sysfs;
+    if (!DEVICE_INFO_CHECK(!sysfs.Root().empty()))
+    {
+        return DeviceInfoTest::Finish("device_info_sysfs_test");
+    }
+
+    const GDT_GfxCardInfo &known = gs_cardInfo.back();
+
+    // Added out of order, to check that the GPUs are sorted by PCI address.
+    sysfs.AddDevice("0000:0a:00.0", kDisplayClass, kAmdVendorId, 0xFFFF, 0x00); // Unknown device ID.
+    sysfs.AddDevice("0000:03:00.0", kDisplayClass, kAmdVendorId, known.m_deviceID, known.m_revID);
+    sysfs.AddDevice("0000:03:00.1", kAudioClass, kAmdVendorId, 0xAB38, 0x00);                      // Not a display controller.
+    sysfs.AddDevice("0000:05:00.0", kDisplayClass, kNvidiaVendorId, 0x2684, 0xA1);                 // Not an AMD device.
+    sysfs.AddDevice("0000:07:00.0", kDisplayClass, kAmdVendorId, known.m_deviceID, std::nullopt);  // No revision attribute.
+    sysfs.SetDevicesMtime(1000);
+
+    AMDTDeviceInfoUtils::SysfsGpuEnumerator enumerator(sysfs.Root().string());
+
+    std::span<const AMDTDeviceInfoUtils::PciGpu> gpus = enumerator.Enumerate();
+    if (DEVICE_INFO_CHECK(gpus.size() == 2))
+    {
+        DEVICE_INFO_CHECK(gpus[0].pciAddress == "0000:03:00.0");
+        DEVICE_INFO_CHECK(gpus[0].vendorID == kAmdVendorId);
+        DEVICE_INFO_CHECK(gpus[0].deviceID == known.m_deviceID);
+        DEVICE_INFO_CHECK(gpus[0].revisionID == known.m_revID);
+        DEVICE_INFO_CHECK(gpus[0].card.has_value() && gs_cardInfo[*gpus[0].card].m_deviceID == known.m_deviceID &&
+                          gs_cardInfo[*gpus[0].card].m_revID == known.m_revID);
+
+        DEVICE_INFO_CHECK(gpus[1].pciAddress == "0000:0a:00.0");
+        DEVICE_INFO_CHECK(gpus[1].deviceID == 0xFFFF);
+        DEVICE_INFO_CHECK(!gpus[1].card.has_value());
+    }
+
+    // A changed attribute does not change the directory, so the cached result is returned.
+    sysfs.RewriteAttribute("0000:0a:00.0", "device", known.m_deviceID);
+    gpus = enumerator.Enumerate();
+    DEVICE_INFO_CHECK(gpus.size() == 2 && gpus[1].deviceID == 0xFFFF);
+
+    // A device added to the directory changes its modification time, so the devices are read again.
+    sysfs.AddDevice("0000:01:00.0", kDisplayClass, kAmdVendorId, known.m_deviceID, known.m_revID);
+    sysfs.SetDevicesMtime(2000);
+    gpus = enumerator.Enumerate();
+    if (DEVICE_INFO_CHECK(gpus.size() == 3))
+    {
+        DEVICE_INFO_CHECK(gpus[0].pciAddress == "0000:01:00.0" && gpus[0].card.has_value());
+        DEVICE_INFO_CHECK(gpus[2].pciAddress == "0000:0a:00.0" && gpus[2].deviceID == known.m_deviceID);
+    }
+
+    // A missing PCI device directory enumerates nothing.
+    AMDTDeviceInfoUtils::SysfsGpuEnumerator missing((sysfs.Root() / "missing").string());
+    DEVICE_INFO_CHECK(missing.Enumerate().empty());
+
+    return DeviceInfoTest::Finish("device_info_sysfs_test");
+}
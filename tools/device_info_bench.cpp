@@ -0,0 +1,885 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Measures the latency of the device info lookups, optionally with hardware performance counters.
+///
+/// Usage: device_info_bench [--perf] [--min-time MS] [--filter TEXT] [--replay FILE [--threads N] | --synthetic N[,N...]]
+///
+/// Every lookup path runs over all the keys of the card info table in a shuffled order, repeatedly until it ran for at least
+/// the minimum time. The results are printed as tab-separated values, one line per path, in nanoseconds per lookup. With --perf
+/// the instructions, cycles, cache misses and branch misses per lookup are counted with perf_event_open as well; if perf events
+/// are unavailable, e.g. in a container, the counters are reported as "-".
+///
+/// With --replay, the lookups of a trace recorded with StartLookupTrace are replayed instead, in their recorded order: first on
+/// one thread, then on N threads at once, each replaying the whole trace. The multi-threaded run reports the latency of every
+/// thread and the combined throughput, so contention shows up as a gap between the two.
+///
+/// With --synthetic, catalogs of N generated cards are registered as a vendor backend, which indexes them at runtime, to show how
+/// the index scales with the size of the catalog: the time and memory the index takes to build, then the lookup latencies.
+//==============================================================================
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <latch>
+#include <optional>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "DeviceInfoGfxTarget.h"
+#include "DeviceInfoNameIndex.h"
+#include "DeviceInfoQuery.h"
+#include "DeviceInfoTrace.h"
+#include "DeviceInfoUtils.h"
+#include "DeviceInfoVendor.h"
+
+namespace
+{
+    using AMDTDeviceInfoUtils::DeviceQuery;
+    using AMDTDeviceInfoUtils::LookupTraceApi;
+    using AMDTDeviceInfoUtils::ResolvedDevice;
+    using AMDTDeviceInfoUtils::ResolvedDeviceName;
+
+    using Clock = std::chrono::steady_clock;
+
+    constexpr uint32_t kShuffleSeed     = 0x1002; ///< Seed of the key order, fixed so runs are comparable.
+    constexpr size_t   kResolveBatch    = 256;    ///< Number of devices or names resolved per ResolveDevices or ResolveDeviceNames call.
+    constexpr uint32_t kUnknownDeviceID = 0xFFFF; ///< A device ID that is not in the card info table.
+
+    constexpr uint32_t kSyntheticVendorId       = 0xFFFE;      ///< PCI vendor ID of the synthetic catalogs, which no real vendor has.
+    constexpr uint32_t kSyntheticRevisionCount  = 2;           ///< Number of revisions of every synthetic device ID.
+    constexpr uint32_t kSyntheticIdMultiplier   = 0x9E3779B1u; ///< Odd multiplier that scatters the synthetic device IDs over 32 bits.
+    constexpr size_t   kMaxSyntheticLookupKeys  = 1 << 20;     ///< Number of keys looked up in a synthetic catalog at most.
+    constexpr size_t   kMaxSyntheticCatalogSize = UINT32_MAX;  ///< Largest synthetic catalog, limited by the 32-bit indexes of a backend.
+
+    /// Keep the compiler from optimizing a lookup result away.
+    template <typename T>
+    inline void KeepResult(const T &value)
+    {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    /// Hardware performance counter values.
+    struct CounterValues
+    {
+        double instructions = 0; ///< Retired instructions.
+        double cycles       = 0; ///< CPU cycles.
+        double cacheMisses  = 0; ///< Last level cache misses.
+        double branchMisses = 0; ///< Mispredicted branches.
+    };
+
+    /// A group of hardware performance counters of the calling thread, read with perf_event_open.
+    class PerfCounters
+    {
+    public:
+        /// Open the counters.
+        /// \param enable false to not open any counter
+        explicit PerfCounters(bool enable)
+        {
+#ifdef __linux__
+            if (!enable)
+            {
+                return;
+            }
+
+            constexpr std::array<uint64_t, kCounterCount> kEvents = {
+                PERF_COUNT_HW_INSTRUCTIONS,
+                PERF_COUNT_HW_CPU_CYCLES,
+                PERF_COUNT_HW_CACHE_MISSES,
+                PERF_COUNT_HW_BRANCH_MISSES,
+            };
+
+            for (size_t i = 0; i < kCounterCount; ++i)
+            {
+                perf_event_attr attr = {};
+                attr.size            = sizeof(attr);
+                attr.type            = PERF_TYPE_HARDWARE;
+                attr.config          = kEvents[i];
+                attr.disabled        = (i == 0) ? 1 : 0;
+                attr.exclude_kernel  = 1;
+                attr.exclude_hv      = 1;
+                attr.read_format     = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+                const int groupFd = (i == 0) ? -1 : m_fds[0];
+                m_fds[i]          = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, 0));
+                if (m_fds[i] < 0)
+                {
+                    std::fprintf(stderr, "device_info_bench: perf events are unavailable (%s), counters are not reported\n", std::strerror(errno));
+                    Close();
+                    return;
+                }
+            }
+#else
+            if (enable)
+            {
+                std::fputs("device_info_bench: perf events are only available on Linux, counters are not reported\n", stderr);
+            }
+#endif
+        }
+
+        ~PerfCounters()
+        {
+            Close();
+        }
+
+        PerfCounters(const PerfCounters &)            = delete;
+        PerfCounters &operator=(const PerfCounters &) = delete;
+
+        /// Reset and start the counters.
+        void Start()
+        {
+#ifdef __linux__
+            if (m_fds[0] >= 0)
+            {
+                ioctl(m_fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+                ioctl(m_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+            }
+#endif
+        }
+
+        /// Stop the counters.
+        /// \return the counts since Start, scaled up if the counters were multiplexed; std::nullopt if the counters are not available
+        std::optional<CounterValues> Stop()
+        {
+#ifdef __linux__
+            if (m_fds[0] < 0)
+            {
+                return std::nullopt;
+            }
+
+            ioctl(m_fds[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+            // The group is read as the number of counters, the enabled and running times, then the counter values.
+            std::array<uint64_t, 3 + kCounterCount> data = {};
+            if (read(m_fds[0], data.data(), sizeof(data)) != static_cast<ssize_t>(sizeof(data)) || data[0] != kCounterCount || data[2] == 0)
+            {
+                return std::nullopt;
+            }
+
+            const double scale = static_cast<double>(data[1]) / static_cast<double>(data[2]);
+            return CounterValues{data[3] * scale, data[4] * scale, data[5] * scale, data[6] * scale};
+#else
+            return std::nullopt;
+#endif
+        }
+
+    private:
+        static constexpr size_t kCounterCount = 4; ///< Number of counters in the group.
+
+        /// Close the counters.
+        void Close()
+        {
+#ifdef __linux__
+            for (int &fd : m_fds)
+            {
+                if (fd >= 0)
+                {
+                    close(fd);
+                    fd = -1;
+                }
+            }
+#endif
+        }
+
+        std::array<int, kCounterCount> m_fds = {-1, -1, -1, -1}; ///< The counters; the first one leads the group.
+    };
+
+    /// Options of a benchmark run.
+    struct BenchOptions
+    {
+        std::chrono::nanoseconds minTime = std::chrono::milliseconds(200); ///< Minimum time to run each lookup path for.
+        std::string_view         filter;                                   ///< Only run the lookup paths whose name contains this.
+    };
+
+    /// Print the header of the result table.
+    void PrintHeader()
+    {
+        std::puts("benchmark\tns_per_op\tinstructions_per_op\tcycles_per_op\tcache_misses_per_op\tbranch_misses_per_op");
+    }
+
+    /// Print a per-lookup counter value, or "-" if there is none.
+    void PrintCounter(std::optional<double> value)
+    {
+        if (value.has_value())
+        {
+            std::printf("\t%.2f", *value);
+        }
+        else
+        {
+            std::fputs("\t-", stdout);
+        }
+    }
+
+    /// Measure a lookup path over a set of keys and print the result.
+    /// \param name the name of the lookup path
+    /// \param keys the keys to look up, in the order to look them up in
+    /// \param lookup called with each key; its result is kept
+    /// \param options the benchmark options
+    /// \param counters the performance counters
+    /// \param lookupsPerPass the number of lookups a pass over all keys does, 0 for one per key
+    template <typename Key, typename Lookup>
+    void Measure(std::string_view name, std::span<const Key> keys, Lookup &&lookup, const BenchOptions &options, PerfCounters &counters, size_t lookupsPerPass = 0)
+    {
+        if (keys.empty() || name.find(options.filter) == std::string_view::npos)
+        {
+            return;
+        }
+
+        auto run_pass = [&]
+        {
+            for (const Key &key : keys)
+            {
+                KeepResult(lookup(key));
+            }
+        };
+
+        // Warm up the caches and the lazily built indexes.
+        run_pass();
+
+        size_t     passes = 0;
+        const auto start  = Clock::now();
+        auto       end    = start;
+        counters.Start();
+        do
+        {
+            run_pass();
+            ++passes;
+            end = Clock::now();
+        } while (end - start < options.minTime);
+        const std::optional<CounterValues> values = counters.Stop();
+
+        const double ops = static_cast<double>(passes * ((lookupsPerPass > 0) ? lookupsPerPass : keys.size()));
+        std::printf("%.*s\t%.2f", static_cast<int>(name.size()), name.data(), std::chrono::duration<double, std::nano>(end - start).count() / ops);
+        PrintCounter(values ? std::optional(values->instructions / ops) : std::nullopt);
+        PrintCounter(values ? std::optional(values->cycles / ops) : std::nullopt);
+        PrintCounter(values ? std::optional(values->cacheMisses / ops) : std::nullopt);
+        PrintCounter(values ? std::optional(values->branchMisses / ops) : std::nullopt);
+        std::putchar('\n');
+    }
+
+    /// Shuffle keys into a fixed pseudo-random order, so the lookups do not follow the table order.
+    template <typename Key>
+    std::vector<Key> Shuffled(std::vector<Key> keys)
+    {
+        std::shuffle(keys.begin(), keys.end(), std::mt19937(kShuffleSeed));
+        return keys;
+    }
+
+    /// A view translator that leaves every name as it is, which disables the gfx target index of CAL name lookups.
+    std::string_view IdentityTranslator(std::string_view deviceName)
+    {
+        return deviceName;
+    }
+
+    /// Run the lookup paths over the keys of the card info table.
+    void BenchTableLookups(const BenchOptions &options, PerfCounters &counters)
+    {
+        std::vector<DeviceQuery>      devices;
+        std::vector<std::string_view> calNames;
+        std::vector<std::string_view> marketingNames;
+        for (const GDT_GfxCardInfo &card : gs_cardInfo)
+        {
+            devices.push_back({AMDTDeviceInfoUtils::kAmdVendorId, card.m_deviceID, card.m_revID});
+            calNames.push_back(card.m_szCALName);
+            marketingNames.push_back(card.m_szMarketingName);
+        }
+        devices        = Shuffled(std::move(devices));
+        calNames       = Shuffled(std::move(calNames));
+        marketingNames = Shuffled(std::move(marketingNames));
+
+        std::vector<DeviceQuery> unknownDevices(devices.size(), {AMDTDeviceInfoUtils::kAmdVendorId, kUnknownDeviceID, AMDTDeviceInfoUtils::kRevisionIdAny});
+
+        std::vector<AMDTDeviceInfoUtils::GfxTargetKey> gfxTargets;
+        for (std::string_view calName : calNames)
+        {
+            if (const auto target = AMDTDeviceInfoUtils::ParseGfxTarget(calName); target.has_value())
+            {
+                gfxTargets.push_back(*target);
+            }
+        }
+
+        std::vector<GDT_HW_ASIC_TYPE> asicTypes;
+        for (int asicType = 0; asicType < GDT_LAST; ++asicType)
+        {
+            asicTypes.push_back(static_cast<GDT_HW_ASIC_TYPE>(asicType));
+        }
+        asicTypes = Shuffled(std::move(asicTypes));
+
+        GDT_DeviceInfo  deviceInfo = {};
+        GDT_GfxCardInfo cardInfo   = {};
+
+        PrintHeader();
+
+        Measure<GDT_HW_ASIC_TYPE>(
+            "GetDeviceInfoForAsicType", asicTypes, [](GDT_HW_ASIC_TYPE asicType) { return &GetDeviceInfoForAsicType(asicType); }, options, counters);
+
+        Measure<DeviceQuery>(
+            "GetDeviceInfo(deviceID)",
+            devices,
+            [&](const DeviceQuery &device) { return AMDTDeviceInfoUtils::GetDeviceInfo(device.deviceID, device.revisionID, deviceInfo); },
+            options,
+            counters);
+
+        Measure<DeviceQuery>(
+            "GetDeviceInfo(deviceID) unknown",
+            unknownDevices,
+            [&](const DeviceQuery &device) { return AMDTDeviceInfoUtils::GetDeviceInfo(device.deviceID, device.revisionID, deviceInfo); },
+            options,
+            counters);
+
+        Measure<DeviceQuery>(
+            "GetDeviceInfo(vendorID, deviceID)",
+            devices,
+            [&](const DeviceQuery &device) { return AMDTDeviceInfoUtils::GetDeviceInfo(device.vendorID, device.deviceID, device.revisionID, cardInfo); },
+            options,
+            counters);
+
+        Measure<DeviceQuery>(
+            "FindCardsByDeviceId",
+            devices,
+            [](const DeviceQuery &device) { return AMDTDeviceInfoUtils::FindCardsByDeviceId(device.deviceID).data(); },
+            options,
+            counters);
+
+        // ResolveDevices is measured per batch, but reported per device.
+        std::vector<std::span<const DeviceQuery>> batches;
+        for (size_t first = 0; first + kResolveBatch <= devices.size(); first += kResolveBatch)
+        {
+            batches.push_back(std::span<const DeviceQuery>(devices).subspan(first, kResolveBatch));
+        }
+        std::array<ResolvedDevice, kResolveBatch> results;
+        Measure<std::span<const DeviceQuery>>(
+            "ResolveDevices", batches, [&](std::span<const DeviceQuery> batch) { return AMDTDeviceInfoUtils::ResolveDevices(batch, results); }, options, counters, batches.size() * kResolveBatch);
+
+        Measure<std::string_view>(
+            "GetDeviceInfo(calName)",
+            calNames,
+            [&](std::string_view calName) { return AMDTDeviceInfoUtils::GetDeviceInfo(calName, deviceInfo); },
+            options,
+            counters);
+
+        // With a translator installed, even gfx target names are compared against every CAL name in the table.
+        AMDTDeviceInfoUtils::SetDeviceNameViewTranslator(IdentityTranslator);
+        Measure<std::string_view>(
+            "GetDeviceInfo(calName) translated",
+            calNames,
+            [&](std::string_view calName) { return AMDTDeviceInfoUtils::GetDeviceInfo(calName, deviceInfo); },
+            options,
+            counters);
+        AMDTDeviceInfoUtils::SetDeviceNameViewTranslator(nullptr);
+
+        // Resolving the names a driver reports takes the device info, the APU flag and the generation of each name, either one
+        // lookup at a time or with ResolveDeviceNames, which is measured per batch, but reported per name.
+        auto look_up_name = [&](std::string_view calName)
+        {
+            bool              isAPU      = false;
+            GDT_HW_GENERATION generation = GDT_HW_GENERATION_NONE;
+            return AMDTDeviceInfoUtils::GetDeviceInfo(calName, deviceInfo) && AMDTDeviceInfoUtils::IsAPU(calName, isAPU) &&
+                   AMDTDeviceInfoUtils::GetHardwareGeneration(calName, generation);
+        };
+
+        std::vector<std::span<const std::string_view>> nameBatches;
+        for (size_t first = 0; first + kResolveBatch <= calNames.size(); first += kResolveBatch)
+        {
+            nameBatches.push_back(std::span<const std::string_view>(calNames).subspan(first, kResolveBatch));
+        }
+        std::array<ResolvedDeviceName, kResolveBatch> nameResults;
+        auto resolve_names = [&](std::span<const std::string_view> batch) { return AMDTDeviceInfoUtils::ResolveDeviceNames(batch, nameResults); };
+
+        for (const bool translated : {false, true})
+        {
+            const std::string suffix = translated ? " translated" : "";
+            AMDTDeviceInfoUtils::SetDeviceNameViewTranslator(translated ? IdentityTranslator : nullptr);
+            Measure<std::string_view>("GetDeviceInfo+IsAPU+GetHardwareGeneration(calName)" + suffix, calNames, look_up_name, options, counters);
+            Measure<std::span<const std::string_view>>("ResolveDeviceNames" + suffix, nameBatches, resolve_names, options, counters, nameBatches.size() * kResolveBatch);
+        }
+        AMDTDeviceInfoUtils::SetDeviceNameViewTranslator(nullptr);
+
+        Measure<AMDTDeviceInfoUtils::GfxTargetKey>(
+            "FindCardsByGfxTarget",
+            gfxTargets,
+            [](AMDTDeviceInfoUtils::GfxTargetKey target) { return AMDTDeviceInfoUtils::FindCardsByGfxTarget(target).data(); },
+            options,
+            counters);
+
+        Measure<std::string_view>(
+            "FindCardsByMarketingName",
+            marketingNames,
+            [](std::string_view marketingName) { return AMDTDeviceInfoUtils::FindCardsByMarketingName(marketingName).data(); },
+            options,
+            counters);
+
+        std::array<AMDTDeviceInfoUtils::CardMatch, 8> matches;
+        Measure<std::string_view>(
+            "SearchCards",
+            marketingNames,
+            [&](std::string_view marketingName) { return AMDTDeviceInfoUtils::SearchCards(marketingName.substr(0, 12), matches); },
+            options,
+            counters);
+    }
+
+    /// A lookup of a trace, prepared for replaying.
+    struct ReplayOp
+    {
+        LookupTraceApi                    api;   ///< The lookup API.
+        DeviceQuery                       query; ///< The device, for device ID lookups.
+        std::string_view                  name;  ///< The name, for name lookups.
+        std::span<const DeviceQuery>      batch; ///< The devices, for ResolveDevices.
+        std::span<const std::string_view> names; ///< The names, for ResolveDeviceNames.
+    };
+
+    /// A recorded trace, prepared for replaying.
+    struct Replay
+    {
+        std::vector<char>             trace;           ///< The contents of the trace file, which the names point into.
+        std::vector<DeviceQuery>      batchQueries;    ///< The devices of every ResolveDevices batch.
+        std::vector<std::string_view> batchNames;      ///< The names of every ResolveDeviceNames batch.
+        std::vector<ReplayOp>         ops;             ///< The lookups, in recorded order.
+        size_t                        lookupCount = 0; ///< The number of lookups the ops do, counting every device or name of a batch.
+    };
+
+    /// Read a trace file and prepare its lookups for replaying.
+    /// \return false if the file cannot be read or is not a trace
+    bool LoadReplay(const char *path, Replay &replay)
+    {
+        FILE *file = std::fopen(path, "rb");
+        if (nullptr == file)
+        {
+            std::fprintf(stderr, "device_info_bench: cannot open %s: %s\n", path, std::strerror(errno));
+            return false;
+        }
+
+        std::array<char, 64 * 1024> buffer;
+        for (size_t size; (size = std::fread(buffer.data(), 1, buffer.size(), file)) > 0;)
+        {
+            replay.trace.insert(replay.trace.end(), buffer.data(), buffer.data() + size);
+        }
+        const bool readFailed = std::ferror(file) != 0;
+        std::fclose(file);
+
+        std::vector<AMDTDeviceInfoUtils::LookupTraceEntry> entries;
+        if (readFailed || !AMDTDeviceInfoUtils::ReadLookupTrace(replay.trace, entries))
+        {
+            std::fprintf(stderr, "device_info_bench: %s is not a lookup trace\n", path);
+            return false;
+        }
+
+        // The batches are views into batchQueries and batchNames, so they must not reallocate.
+        replay.batchQueries.reserve(entries.size());
+        replay.batchNames.reserve(entries.size());
+        for (const AMDTDeviceInfoUtils::LookupTraceEntry &entry : entries)
+        {
+            const DeviceQuery query = {entry.vendorID, entry.deviceID, entry.revisionID};
+            if (entry.api != LookupTraceApi::kResolveDevices && entry.api != LookupTraceApi::kResolveDeviceNames)
+            {
+                replay.ops.push_back({entry.api, query, entry.name, {}, {}});
+                continue;
+            }
+
+            // Consecutive records of a batch API form one batch, up to the size of the results buffer.
+            ReplayOp *last = replay.ops.empty() ? nullptr : &replay.ops.back();
+            if (nullptr == last || last->api != entry.api || last->batch.size() + last->names.size() == kResolveBatch)
+            {
+                replay.ops.push_back({entry.api,
+                                      {},
+                                      {},
+                                      std::span<const DeviceQuery>(replay.batchQueries.data() + replay.batchQueries.size(), 0),
+                                      std::span<const std::string_view>(replay.batchNames.data() + replay.batchNames.size(), 0)});
+                last = &replay.ops.back();
+            }
+
+            if (entry.api == LookupTraceApi::kResolveDevices)
+            {
+                replay.batchQueries.push_back(query);
+                last->batch = std::span<const DeviceQuery>(last->batch.data(), last->batch.size() + 1);
+            }
+            else
+            {
+                replay.batchNames.push_back(entry.name);
+                last->names = std::span<const std::string_view>(last->names.data(), last->names.size() + 1);
+            }
+        }
+
+        replay.lookupCount = entries.size();
+        return true;
+    }
+
+    /// Replays the lookups of a trace on one thread.
+    class Replayer
+    {
+    public:
+        /// Replay a lookup.
+        /// \return whether the lookup found anything
+        bool operator()(const ReplayOp &op)
+        {
+            switch (op.api)
+            {
+                case LookupTraceApi::kDeviceId:
+                    return AMDTDeviceInfoUtils::GetDeviceInfo(op.query.vendorID, op.query.deviceID, op.query.revisionID, m_deviceInfo);
+
+                case LookupTraceApi::kCalName:
+                    return AMDTDeviceInfoUtils::GetDeviceInfo(op.name, m_deviceInfo);
+
+                case LookupTraceApi::kMarketingName:
+                    return !AMDTDeviceInfoUtils::FindCardsByMarketingName(op.name).empty();
+
+                case LookupTraceApi::kResolveDevices:
+                    return AMDTDeviceInfoUtils::ResolveDevices(op.batch, m_results) > 0;
+
+                case LookupTraceApi::kResolveDeviceNames:
+                    return AMDTDeviceInfoUtils::ResolveDeviceNames(op.names, m_nameResults) > 0;
+            }
+            return false;
+        }
+
+    private:
+        GDT_DeviceInfo                                m_deviceInfo = {}; ///< Output of the device info lookups.
+        std::array<ResolvedDevice, kResolveBatch>     m_results;         ///< Output of ResolveDevices.
+        std::array<ResolvedDeviceName, kResolveBatch> m_nameResults;     ///< Output of ResolveDeviceNames.
+    };
+
+    /// Replay a trace on one thread, then on threadCount threads at once, and print the results.
+    void BenchReplay(const Replay &replay, unsigned threadCount, const BenchOptions &options, PerfCounters &counters)
+    {
+        PrintHeader();
+
+        Replayer replayer;
+        Measure<ReplayOp>("replay", replay.ops, replayer, options, counters, replay.lookupCount);
+
+        // Every thread replays the whole trace for at least the minimum time, starting at the same time.
+        struct ThreadResult
+        {
+            size_t                   passes  = 0;  ///< Number of passes over the trace.
+            std::chrono::nanoseconds elapsed = {}; ///< Time the passes took.
+        };
+
+        std::vector<ThreadResult> results(threadCount);
+        std::vector<std::thread>  threads;
+        std::latch                ready(threadCount + 1);
+        std::latch                start(1);
+        for (unsigned i = 0; i < threadCount; ++i)
+        {
+            threads.emplace_back(
+                [&, i]
+                {
+                    Replayer threadReplayer;
+                    auto     run_pass = [&]
+                    {
+                        for (const ReplayOp &op : replay.ops)
+                        {
+                            KeepResult(threadReplayer(op));
+                        }
+                    };
+
+                    run_pass();
+                    ready.count_down();
+                    start.wait();
+
+                    const auto threadStart = Clock::now();
+                    auto       threadEnd   = threadStart;
+                    do
+                    {
+                        run_pass();
+                        ++results[i].passes;
+                        threadEnd = Clock::now();
+                    } while (threadEnd - threadStart < options.minTime);
+                    results[i].elapsed = threadEnd - threadStart;
+                });
+        }
+
+        ready.arrive_and_wait();
+        const auto wallStart = Clock::now();
+        start.count_down();
+        for (std::thread &thread : threads)
+        {
+            thread.join();
+        }
+        const std::chrono::duration<double, std::nano> wallTime = Clock::now() - wallStart;
+
+        size_t totalPasses = 0;
+        for (unsigned i = 0; i < threadCount; ++i)
+        {
+            const double lookups = static_cast<double>(results[i].passes * replay.lookupCount);
+            std::printf("replay thread %u/%u\t%.2f\t-\t-\t-\t-\n", i + 1, threadCount, std::chrono::duration<double, std::nano>(results[i].elapsed).count() / lookups);
+            totalPasses += results[i].passes;
+        }
+
+        // The combined row is the wall time per lookup of all threads together, i.e. the inverse of the throughput.
+        std::printf("replay %u threads combined\t%.2f\t-\t-\t-\t-\n", threadCount, wallTime.count() / static_cast<double>(totalPasses * replay.lookupCount));
+    }
+
+    /// A generated catalog of cards, in the form of a vendor backend.
+    struct SyntheticCatalog
+    {
+        std::vector<GDT_GfxCardInfo> cards;      ///< The cards.
+        std::vector<GDT_DeviceInfo>  deviceInfo; ///< The device info of each card.
+    };
+
+    /// Get the device ID of a synthetic device. Distinct indexes give distinct IDs, since the multiplier is odd.
+    constexpr uint32_t SyntheticDeviceId(size_t index)
+    {
+        return static_cast<uint32_t>(index) * kSyntheticIdMultiplier;
+    }
+
+    /// Generate a catalog with kSyntheticRevisionCount revisions of every device ID and the device info of the real ASIC types.
+    SyntheticCatalog MakeSyntheticCatalog(size_t cardCount)
+    {
+        SyntheticCatalog catalog;
+        catalog.cards.reserve(cardCount);
+        catalog.deviceInfo.reserve(cardCount);
+        for (size_t i = 0; i < cardCount; ++i)
+        {
+            const auto asicType = static_cast<GDT_HW_ASIC_TYPE>(i % GDT_LAST);
+            catalog.cards.push_back(
+                {GDT_ASIC_TYPE_NONE, SyntheticDeviceId(i / kSyntheticRevisionCount), static_cast<uint32_t>(i % kSyntheticRevisionCount), GDT_HW_GENERATION_NONE, false, "synthetic", "Synthetic GPU"});
+            catalog.deviceInfo.push_back(GetDeviceInfoForAsicType(asicType));
+        }
+        return catalog;
+    }
+
+    /// Get the number of bytes allocated with malloc, if the C library reports it.
+    std::optional<size_t> AllocatedBytes()
+    {
+#ifdef __GLIBC__
+        // Large blocks are allocated with mmap and counted separately.
+        const struct mallinfo2 info = mallinfo2();
+        return info.uordblks + info.hblkhd;
+#else
+        return std::nullopt;
+#endif
+    }
+
+    /// Time and memory it took to index a synthetic catalog.
+    struct IndexBuildResult
+    {
+        size_t                   cardCount = 0;  ///< Number of cards in the catalog.
+        std::chrono::nanoseconds buildTime = {}; ///< Time RegisterVendorBackend took.
+        std::optional<size_t>    indexSize;      ///< Bytes RegisterVendorBackend allocated, if known.
+    };
+
+    /// Index synthetic catalogs of the specified sizes as a vendor backend and measure the lookups into them.
+    void BenchSyntheticCatalogs(std::span<const size_t> cardCounts, const BenchOptions &options, PerfCounters &counters)
+    {
+        std::vector<IndexBuildResult> builds;
+
+        PrintHeader();
+        for (const size_t cardCount : cardCounts)
+        {
+            const SyntheticCatalog catalog = MakeSyntheticCatalog(cardCount);
+
+            const std::optional<size_t> allocatedBefore = AllocatedBytes();
+            const auto                  start           = Clock::now();
+            if (!AMDTDeviceInfoUtils::RegisterVendorBackend({kSyntheticVendorId, catalog.cards, catalog.deviceInfo}))
+            {
+                std::fprintf(stderr, "device_info_bench: cannot register a synthetic catalog of %zu cards\n", cardCount);
+                continue;
+            }
+            const auto                  buildTime      = Clock::now() - start;
+            const std::optional<size_t> allocatedAfter = AllocatedBytes();
+            builds.push_back({cardCount,
+                              buildTime,
+                              (allocatedBefore && allocatedAfter) ? std::optional(*allocatedAfter - *allocatedBefore) : std::nullopt});
+
+            // Look up a random sample of the devices, and as many device IDs that are not in the catalog.
+            const size_t             deviceIdCount = (cardCount + kSyntheticRevisionCount - 1) / kSyntheticRevisionCount;
+            std::mt19937_64          random(kShuffleSeed);
+            std::vector<DeviceQuery> devices;
+            std::vector<DeviceQuery> unknownDevices;
+            for (size_t i = 0; i < std::min(cardCount, kMaxSyntheticLookupKeys); ++i)
+            {
+                const size_t card = random() % cardCount;
+                devices.push_back({kSyntheticVendorId, catalog.cards[card].m_deviceID, catalog.cards[card].m_revID});
+                unknownDevices.push_back({kSyntheticVendorId, SyntheticDeviceId(deviceIdCount + random() % deviceIdCount), AMDTDeviceInfoUtils::kRevisionIdAny});
+            }
+
+            const std::string prefix = "synthetic " + std::to_string(cardCount) + " ";
+
+            GDT_GfxCardInfo cardInfo = {};
+            Measure<DeviceQuery>(
+                prefix + "GetDeviceInfo(vendorID, deviceID)",
+                devices,
+                [&](const DeviceQuery &device) { return AMDTDeviceInfoUtils::GetDeviceInfo(device.vendorID, device.deviceID, device.revisionID, cardInfo); },
+                options,
+                counters);
+
+            Measure<DeviceQuery>(
+                prefix + "GetDeviceInfo(vendorID, deviceID) unknown",
+                unknownDevices,
+                [&](const DeviceQuery &device) { return AMDTDeviceInfoUtils::GetDeviceInfo(device.vendorID, device.deviceID, device.revisionID, cardInfo); },
+                options,
+                counters);
+
+            std::vector<std::span<const DeviceQuery>> batches;
+            for (size_t first = 0; first + kResolveBatch <= devices.size(); first += kResolveBatch)
+            {
+                batches.push_back(std::span<const DeviceQuery>(devices).subspan(first, kResolveBatch));
+            }
+            std::array<ResolvedDevice, kResolveBatch> results;
+            Measure<std::span<const DeviceQuery>>(
+                prefix + "ResolveDevices",
+                batches,
+                [&](std::span<const DeviceQuery> batch) { return AMDTDeviceInfoUtils::ResolveDevices(batch, results); },
+                options,
+                counters,
+                batches.size() * kResolveBatch);
+
+            // The catalog is freed below, so no lookup may see it afterwards. No lookup runs on another thread, so the index can be
+            // freed as well, which keeps the memory measured for the next size from including the indexes of the previous ones.
+            AMDTDeviceInfoUtils::UnregisterVendorBackend(kSyntheticVendorId);
+            AMDTDeviceInfoUtils::ReleaseRetiredVendorBackends();
+        }
+
+        std::puts("\ncards\tbuild_ms\tbuild_ns_per_card\tindex_bytes\tindex_bytes_per_card");
+        for (const IndexBuildResult &build : builds)
+        {
+            const double buildNs = std::chrono::duration<double, std::nano>(build.buildTime).count();
+            std::printf("%zu\t%.3f\t%.2f", build.cardCount, buildNs / 1e6, buildNs / static_cast<double>(build.cardCount));
+            if (build.indexSize.has_value())
+            {
+                std::printf("\t%zu\t%.2f\n", *build.indexSize, static_cast<double>(*build.indexSize) / static_cast<double>(build.cardCount));
+            }
+            else
+            {
+                std::puts("\t-\t-");
+            }
+        }
+    }
+
+    /// Parse a comma separated list of catalog sizes.
+    /// \return false if the list is malformed or holds a size that is 0 or too large
+    bool ParseCatalogSizes(std::string_view list, std::vector<size_t> &cardCounts)
+    {
+        while (!list.empty())
+        {
+            const size_t           comma  = list.find(',');
+            const std::string_view item   = list.substr(0, comma);
+            size_t                 value  = 0;
+            const auto             result = std::from_chars(item.data(), item.data() + item.size(), value);
+            if (result.ec != std::errc() || result.ptr != item.data() + item.size() || value == 0 || value > kMaxSyntheticCatalogSize)
+            {
+                return false;
+            }
+            cardCounts.push_back(value);
+            list = (comma == std::string_view::npos) ? std::string_view() : list.substr(comma + 1);
+        }
+        return !cardCounts.empty();
+    }
+
+    void PrintUsage()
+    {
+        std::fputs("Usage: device_info_bench [--perf] [--min-time MS] [--filter TEXT] [--replay FILE [--threads N] | --synthetic N[,N...]]\n"
+                   "Measures the device info lookups in nanoseconds per lookup, and with --perf in hardware events per lookup.\n"
+                   "With --replay, replays the lookups of a trace recorded with StartLookupTrace on one and on N threads.\n"
+                   "With --synthetic, measures indexing and lookups of generated catalogs of N cards, e.g. 1000,100000,10000000.\n",
+                   stderr);
+    }
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    BenchOptions options;
+    bool         perf        = false;
+    const char  *replayPath  = nullptr;
+    unsigned     threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+    std::vector<size_t> catalogSizes;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view arg = argv[i];
+        if (arg == "--perf")
+        {
+            perf = true;
+        }
+        else if (arg == "--min-time" && i + 1 < argc)
+        {
+            const std::string_view value        = argv[++i];
+            unsigned               milliseconds = 0;
+            const auto             result       = std::from_chars(value.data(), value.data() + value.size(), milliseconds);
+            if (result.ec != std::errc() || result.ptr != value.data() + value.size())
+            {
+                PrintUsage();
+                return 2;
+            }
+            options.minTime = std::chrono::milliseconds(milliseconds);
+        }
+        else if (arg == "--filter" && i + 1 < argc)
+        {
+            options.filter = argv[++i];
+        }
+        else if (arg == "--replay" && i + 1 < argc)
+        {
+            replayPath = argv[++i];
+        }
+        else if (arg == "--synthetic" && i + 1 < argc)
+        {
+            if (!ParseCatalogSizes(argv[++i], catalogSizes))
+            {
+                PrintUsage();
+                return 2;
+            }
+        }
+        else if (arg == "--threads" && i + 1 < argc)
+        {
+            const std::string_view value  = argv[++i];
+            const auto             result = std::from_chars(value.data(), value.data() + value.size(), threadCount);
+            if (result.ec != std::errc() || result.ptr != value.data() + value.size() || threadCount == 0)
+            {
+                PrintUsage();
+                return 2;
+            }
+        }
+        else
+        {
+            PrintUsage();
+            return 2;
+        }
+    }
+
+    if (nullptr != replayPath && !catalogSizes.empty())
+    {
+        PrintUsage();
+        return 2;
+    }
+
+    PerfCounters counters(perf);
+    if (!catalogSizes.empty())
+    {
+        BenchSyntheticCatalogs(catalogSizes, options, counters);
+    }
+    else if (nullptr != replayPath)
+    {
+        Replay replay;
+        if (!LoadReplay(replayPath, replay))
+        {
+            return 1;
+        }
+        BenchReplay(replay, threadCount, options, counters);
+    }
+    else
+    {
+        BenchTableLookups(options, counters);
+    }
+    return 0;
+}
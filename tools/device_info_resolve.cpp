@@ -0,0 +1,656 @@
+//==============================================================================
+/// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Resolves a stream of "vendor:device:revision" lines to device info.
+///
+/// Usage: device_info_resolve [--format tsv|ndjson] [--threads N] [FILE]
+///
+/// Each input line holds a PCI vendor ID, device ID and optional revision ID in hexadecimal, e.g. "1002:744c:c8". The
+/// input is FILE, which is memory mapped, or stdin if there is no FILE. It is split into chunks at line boundaries that
+/// are resolved in parallel, and the output of the chunks is written in input order, one output line per input line. Each
+/// output line has the status "ok", "not_found", "invalid" for a malformed line, or "empty" for a blank line.
+//==============================================================================
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <charconv>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "DeviceInfoUtils.h"
+#include "DeviceInfoVendor.h"
+
+namespace
+{
+    using AMDTDeviceInfoUtils::DeviceQuery;
+    using AMDTDeviceInfoUtils::ResolvedDevice;
+
+    constexpr size_t kChunkSize = 4 * 1024 * 1024; ///< Size of the input chunks that are resolved in one piece.
+
+    /// Output formats.
+    enum class OutputFormat
+    {
+        kTsv,    ///< Tab-separated values with a header line.
+        kNdjson, ///< One JSON object per line.
+    };
+
+    /// The output fields of a device, formatted once per chunk since inputs repeat the same few devices.
+    struct FormattedDevice
+    {
+        ResolvedDevice device; ///< The device.
+        std::string    fields; ///< The output fields after the status.
+    };
+
+    constexpr size_t kFormattedDeviceCacheSize = 64; ///< Number of formatted devices cached by a chunk.
+
+    /// An input line of a chunk.
+    struct InputLine
+    {
+        std::string_view text;  ///< The line, trimmed.
+        bool             valid; ///< Whether the line was parsed; invalid and blank lines are not looked up.
+    };
+
+    /// A chunk of input lines and the output produced for them.
+    /// The vectors of a chunk keep their capacity, so a chunk that is reused allocates only when it holds more lines than before.
+    struct Chunk
+    {
+        std::vector<char>                                      buffer;          ///< Storage of the input when it is read from a stream.
+        std::string_view                                       text;            ///< The input lines, ending at a line boundary.
+        std::string                                            output;          ///< The output lines.
+        std::vector<InputLine>                                 lines;           ///< The input lines, one per output line.
+        std::vector<DeviceQuery>                               queries;         ///< The valid input lines, parsed.
+        std::vector<ResolvedDevice>                            results;         ///< The result of each query.
+        std::array<FormattedDevice, kFormattedDeviceCacheSize> formatted;       ///< Direct-mapped cache of formatted devices.
+        bool                                                   pending = false; ///< Whether the chunk is queued or being resolved.
+    };
+
+    /// Parse a hexadecimal number, with an optional "0x" prefix.
+    /// \return the number, or std::nullopt if the text is not a hexadecimal number
+    std::optional<uint32_t> ParseHex(std::string_view text)
+    {
+        if (text.starts_with("0x") || text.starts_with("0X"))
+        {
+            text.remove_prefix(2);
+        }
+
+        uint32_t   value  = 0;
+        const auto result = std::from_chars(text.data(), text.data() + text.size(), value, 16);
+        if (result.ec != std::errc() || result.ptr != text.data() + text.size() || text.empty())
+        {
+            return std::nullopt;
+        }
+        return value;
+    }
+
+    /// Parse a "vendor:device[:revision]" line.
+    /// \return the query, or std::nullopt if the line is malformed
+    std::optional<DeviceQuery> ParseLine(std::string_view line)
+    {
+        const size_t vendorEnd = line.find(':');
+        if (vendorEnd == std::string_view::npos)
+        {
+            return std::nullopt;
+        }
+
+        const size_t deviceEnd = line.find(':', vendorEnd + 1);
+
+        const std::optional<uint32_t> vendorID = ParseHex(line.substr(0, vendorEnd));
+        const std::optional<uint32_t> deviceID = ParseHex(line.substr(vendorEnd + 1, deviceEnd - (vendorEnd + 1)));
+        const std::optional<uint32_t> revisionID =
+            (deviceEnd == std::string_view::npos) ? AMDTDeviceInfoUtils::kRevisionIdAny : ParseHex(line.substr(deviceEnd + 1));
+        if (!vendorID.has_value() || !deviceID.has_value() || !revisionID.has_value())
+        {
+            return std::nullopt;
+        }
+
+        return DeviceQuery{*vendorID, *deviceID, *revisionID};
+    }
+
+    /// Remove the leading and trailing whitespace of a line, including the carriage return of a CRLF line ending.
+    std::string_view Trim(std::string_view line)
+    {
+        constexpr std::string_view kWhitespace = " \t\r";
+
+        const size_t first = line.find_first_not_of(kWhitespace);
+        if (first == std::string_view::npos)
+        {
+            return {};
+        }
+        return line.substr(first, line.find_last_not_of(kWhitespace) + 1 - first);
+    }
+
+    /// Append a number in decimal.
+    void AppendNumber(std::string &output, uint32_t value)
+    {
+        char       digits[10];
+        const auto result = std::to_chars(digits, digits + sizeof(digits), value);
+        output.append(digits, result.ptr);
+    }
+
+    /// Append a string as a quoted JSON string.
+    void AppendJsonString(std::string &output, std::string_view text)
+    {
+        output += '"';
+        for (const char c : text)
+        {
+            if (c == '"' || c == '\\')
+            {
+                output += '\\';
+                output += c;
+            }
+            else if (static_cast<unsigned char>(c) < 0x20)
+            {
+                constexpr char kHexDigits[] = "0123456789abcdef";
+                output.append("\\u00");
+                output += kHexDigits[(c >> 4) & 0xF];
+                output += kHexDigits[c & 0xF];
+            }
+            else
+            {
+                output += c;
+            }
+        }
+        output += '"';
+    }
+
+    /// Append a string as a TSV field, replacing the characters that would break the record structure.
+    void AppendTsvField(std::string &output, std::string_view text)
+    {
+        for (const char c : text)
+        {
+            output += (c == '\t' || c == '\n') ? ' ' : c;
+        }
+    }
+
+    /// Append the output fields of a device that follow the status.
+    void FormatDevice(OutputFormat format, const ResolvedDevice &device, std::string &output)
+    {
+        if (nullptr == device.cardInfo)
+        {
+            if (format == OutputFormat::kTsv)
+            {
+                output.append(9, '\t');
+            }
+            return;
+        }
+
+        const GDT_GfxCardInfo &card           = *device.cardInfo;
+        const GDT_DeviceInfo  &info           = *device.deviceInfo;
+        const std::string_view calName        = (nullptr != card.m_szCALName) ? card.m_szCALName : "";
+        const std::string_view marketingName  = (nullptr != card.m_szMarketingName) ? card.m_szMarketingName : "";
+        const std::string_view generationName = AMDTDeviceInfoUtils::GetHardwareGenerationDisplayName(card.m_generation);
+
+        if (format == OutputFormat::kTsv)
+        {
+            output += '\t';
+            AppendTsvField(output, calName);
+            output += '\t';
+            AppendTsvField(output, marketingName);
+            output += '\t';
+            output += generationName;
+            output += '\t';
+            output += card.m_bAPU ? '1' : '0';
+            output += '\t';
+            AppendNumber(output, info.numberCUs());
+            output += '\t';
+            AppendNumber(output, info.m_nNumShaderEngines);
+            output += '\t';
+            AppendNumber(output, info.numberSIMDs());
+            output += '\t';
+            AppendNumber(output, info.numberVGPRs());
+            output += '\t';
+            AppendNumber(output, info.m_nWaveSize);
+            return;
+        }
+
+        output += ",\"calName\":";
+        AppendJsonString(output, calName);
+        output += ",\"marketingName\":";
+        AppendJsonString(output, marketingName);
+        output += ",\"generation\":";
+        AppendJsonString(output, generationName);
+        output += ",\"apu\":";
+        output += card.m_bAPU ? "true" : "false";
+        output += ",\"numCUs\":";
+        AppendNumber(output, info.numberCUs());
+        output += ",\"numShaderEngines\":";
+        AppendNumber(output, info.m_nNumShaderEngines);
+        output += ",\"numSIMDs\":";
+        AppendNumber(output, info.numberSIMDs());
+        output += ",\"numVGPRs\":";
+        AppendNumber(output, info.numberVGPRs());
+        output += ",\"waveSize\":";
+        AppendNumber(output, info.m_nWaveSize);
+    }
+
+    /// Get the output fields of a device from the cache of a chunk, formatting them on a miss.
+    std::string_view FormattedFields(OutputFormat format, const ResolvedDevice &device, Chunk &chunk)
+    {
+        const size_t     slot   = (reinterpret_cast<uintptr_t>(device.cardInfo) / sizeof(GDT_GfxCardInfo)) % kFormattedDeviceCacheSize;
+        FormattedDevice &cached = chunk.formatted[slot];
+        if (cached.device.cardInfo != device.cardInfo || cached.device.deviceInfo != device.deviceInfo || cached.fields.empty())
+        {
+            cached.device = device;
+            cached.fields.clear();
+            FormatDevice(format, device, cached.fields);
+        }
+        return cached.fields;
+    }
+
+    /// Resolve the lines of a chunk and format its output.
+    void ResolveChunk(OutputFormat format, Chunk &chunk)
+    {
+        chunk.lines.clear();
+        chunk.queries.clear();
+        chunk.output.clear();
+
+        std::string_view text = chunk.text;
+        while (!text.empty())
+        {
+            const size_t           lineEnd = std::min(text.find('\n'), text.size());
+            const std::string_view line    = Trim(text.substr(0, lineEnd));
+            text.remove_prefix(std::min(lineEnd + 1, text.size()));
+
+            const std::optional<DeviceQuery> query = line.empty() ? std::nullopt : ParseLine(line);
+            chunk.lines.push_back({line, query.has_value()});
+            if (query.has_value())
+            {
+                chunk.queries.push_back(*query);
+            }
+        }
+
+        chunk.results.resize(chunk.queries.size());
+        AMDTDeviceInfoUtils::ResolveDevices(chunk.queries, chunk.results);
+
+        size_t result = 0;
+        for (const InputLine &line : chunk.lines)
+        {
+            const ResolvedDevice   device = line.valid ? chunk.results[result++] : ResolvedDevice();
+            const std::string_view status =
+                line.valid ? ((nullptr != device.cardInfo) ? "ok" : "not_found") : (line.text.empty() ? "empty" : "invalid");
+
+            // Valid lines hold only hexadecimal digits and colons, so only invalid ones need escaping.
+            if (format == OutputFormat::kTsv)
+            {
+                if (line.valid)
+                {
+                    chunk.output += line.text;
+                }
+                else
+                {
+                    AppendTsvField(chunk.output, line.text);
+                }
+                chunk.output += '\t';
+                chunk.output += status;
+                chunk.output += FormattedFields(format, device, chunk);
+                chunk.output += '\n';
+            }
+            else
+            {
+                chunk.output += "{\"input\":";
+                if (line.valid)
+                {
+                    chunk.output += '"';
+                    chunk.output += line.text;
+                    chunk.output += '"';
+                }
+                else
+                {
+                    AppendJsonString(chunk.output, line.text);
+                }
+                chunk.output += ",\"status\":\"";
+                chunk.output += status;
+                chunk.output += '"';
+                chunk.output += FormattedFields(format, device, chunk);
+                chunk.output += "}\n";
+            }
+        }
+    }
+
+    /// Write a buffer to stdout.
+    /// \return false if writing failed
+    bool WriteAll(std::string_view data)
+    {
+        while (!data.empty())
+        {
+            const ssize_t written = write(STDOUT_FILENO, data.data(), data.size());
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                return false;
+            }
+            data.remove_prefix(static_cast<size_t>(written));
+        }
+        return true;
+    }
+
+    /// Provides the input in chunks that end at line boundaries.
+    class InputReader
+    {
+    public:
+        /// Read a memory mapped file.
+        explicit InputReader(std::string_view mapped)
+            : m_mapped(mapped)
+            , m_stdin(false)
+        {
+        }
+
+        /// Read stdin.
+        InputReader() = default;
+
+        /// Get the next chunk of input.
+        /// \param[out] chunk receives the input in text, which is stored in buffer unless the input is memory mapped
+        /// \return false at the end of the input or on a read error
+        bool Next(Chunk &chunk)
+        {
+            return m_stdin ? NextFromStdin(chunk) : NextMapped(chunk);
+        }
+
+        /// Whether reading stdin failed.
+        [[nodiscard]] bool Failed() const
+        {
+            return m_failed;
+        }
+
+    private:
+        bool NextMapped(Chunk &chunk)
+        {
+            if (m_mapped.empty())
+            {
+                return false;
+            }
+
+            size_t size = std::min(kChunkSize, m_mapped.size());
+            if (size < m_mapped.size())
+            {
+                const size_t lineEnd = m_mapped.find('\n', size - 1);
+                size                 = (lineEnd == std::string_view::npos) ? m_mapped.size() : lineEnd + 1;
+            }
+
+            chunk.text = m_mapped.substr(0, size);
+            m_mapped.remove_prefix(size);
+            return true;
+        }
+
+        bool NextFromStdin(Chunk &chunk)
+        {
+            // Start with the partial line that ended the previous chunk.
+            chunk.buffer.resize(std::max(kChunkSize, m_carry.size() * 2));
+            std::copy(m_carry.begin(), m_carry.end(), chunk.buffer.begin());
+            size_t size = m_carry.size();
+            m_carry.clear();
+
+            for (;;)
+            {
+                bool atEnd = false;
+                while (!atEnd && size < chunk.buffer.size())
+                {
+                    const ssize_t count = read(STDIN_FILENO, chunk.buffer.data() + size, chunk.buffer.size() - size);
+                    if (count < 0 && errno == EINTR)
+                    {
+                        continue;
+                    }
+                    atEnd    = count <= 0;
+                    m_failed = count < 0;
+                    size += atEnd ? 0 : static_cast<size_t>(count);
+                }
+
+                if (atEnd)
+                {
+                    chunk.text = std::string_view(chunk.buffer.data(), size);
+                    m_stdin    = false;
+                    return size > 0;
+                }
+
+                const std::string_view data(chunk.buffer.data(), size);
+                const size_t           lineEnd = data.rfind('\n');
+                if (lineEnd != std::string_view::npos)
+                {
+                    m_carry.assign(data.begin() + static_cast<ptrdiff_t>(lineEnd + 1), data.end());
+                    chunk.text = data.substr(0, lineEnd + 1);
+                    return true;
+                }
+
+                // A single line fills the whole buffer.
+                chunk.buffer.resize(chunk.buffer.size() * 2);
+            }
+        }
+
+        std::string_view  m_mapped;         ///< The rest of the memory mapped input.
+        std::vector<char> m_carry;          ///< The partial line at the end of the last chunk read from stdin.
+        bool              m_stdin  = true;  ///< Whether the input is read from stdin and its end has not been reached.
+        bool              m_failed = false; ///< Whether reading stdin failed.
+    };
+
+    /// Resolves chunks on a pool of threads.
+    class ChunkResolver
+    {
+    public:
+        ChunkResolver(OutputFormat format, unsigned threadCount)
+            : m_format(format)
+        {
+            for (unsigned i = 0; i < threadCount; ++i)
+            {
+                m_threads.emplace_back([this] { Run(); });
+            }
+        }
+
+        ~ChunkResolver()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stopping = true;
+            }
+            m_queued.notify_all();
+            for (std::thread &thread : m_threads)
+            {
+                thread.join();
+            }
+        }
+
+        /// Queue a chunk to be resolved.
+        void Submit(Chunk &chunk)
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                chunk.pending = true;
+                m_queue.push_back(&chunk);
+            }
+            m_queued.notify_one();
+        }
+
+        /// Wait until a chunk is resolved.
+        void Wait(const Chunk &chunk)
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_resolved.wait(lock, [&] { return !chunk.pending; });
+        }
+
+    private:
+        void Run()
+        {
+            for (;;)
+            {
+                Chunk *chunk = nullptr;
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    m_queued.wait(lock, [this] { return m_stopping || !m_queue.empty(); });
+                    if (m_queue.empty())
+                    {
+                        return;
+                    }
+                    chunk = m_queue.front();
+                    m_queue.pop_front();
+                }
+
+                ResolveChunk(m_format, *chunk);
+
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    chunk->pending = false;
+                }
+                m_resolved.notify_all();
+            }
+        }
+
+        OutputFormat             m_format;           ///< The output format.
+        std::vector<std::thread> m_threads;          ///< The worker threads.
+        std::mutex               m_mutex;            ///< Guards the queue and the pending flags of the chunks.
+        std::condition_variable  m_queued;           ///< Signaled when a chunk is queued or the workers stop.
+        std::condition_variable  m_resolved;         ///< Signaled when a chunk is resolved.
+        std::deque<Chunk *>      m_queue;            ///< The chunks waiting for a worker.
+        bool                     m_stopping = false; ///< Whether the workers should exit once the queue is empty.
+    };
+
+    /// Resolve the whole input, writing the output of the chunks in input order.
+    /// Reading, resolving and writing overlap: the chunks form a ring twice as large as the thread pool, and a chunk is
+    /// refilled as soon as its output has been written.
+    /// \return false if reading or writing failed
+    bool Resolve(InputReader &reader, OutputFormat format, unsigned threadCount)
+    {
+        std::vector<Chunk> chunks(threadCount * 2);
+        ChunkResolver      resolver(format, threadCount);
+
+        bool   succeeded = true;
+        size_t next      = 0;
+        for (;; ++next)
+        {
+            Chunk &chunk = chunks[next % chunks.size()];
+            if (next >= chunks.size())
+            {
+                resolver.Wait(chunk);
+                succeeded = succeeded && WriteAll(chunk.output);
+            }
+
+            if (!succeeded || !reader.Next(chunk))
+            {
+                break;
+            }
+            resolver.Submit(chunk);
+        }
+
+        // Write the chunks that are still in flight, oldest first.
+        for (size_t i = next + 1; i < next + chunks.size(); ++i)
+        {
+            if (i >= chunks.size())
+            {
+                Chunk &chunk = chunks[i % chunks.size()];
+                resolver.Wait(chunk);
+                succeeded = succeeded && WriteAll(chunk.output);
+            }
+        }
+
+        return succeeded && !reader.Failed();
+    }
+
+    void PrintUsage()
+    {
+        std::fputs("Usage: device_info_resolve [--format tsv|ndjson] [--threads N] [FILE]\n"
+                   "Resolves lines of hexadecimal \"vendor:device[:revision]\" IDs read from FILE or stdin.\n",
+                   stderr);
+    }
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    OutputFormat format      = OutputFormat::kTsv;
+    unsigned     threadCount = std::max(1u, std::thread::hardware_concurrency());
+    const char  *path        = nullptr;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view arg = argv[i];
+        if (arg == "--format" && i + 1 < argc)
+        {
+            const std::string_view value = argv[++i];
+            if (value != "tsv" && value != "ndjson")
+            {
+                PrintUsage();
+                return 2;
+            }
+            format = (value == "tsv") ? OutputFormat::kTsv : OutputFormat::kNdjson;
+        }
+        else if (arg == "--threads" && i + 1 < argc)
+        {
+            const std::string_view value  = argv[++i];
+            const auto             result = std::from_chars(value.data(), value.data() + value.size(), threadCount);
+            if (result.ec != std::errc() || result.ptr != value.data() + value.size() || threadCount == 0)
+            {
+                PrintUsage();
+                return 2;
+            }
+        }
+        else if (arg.starts_with("-") || nullptr != path)
+        {
+            PrintUsage();
+            return 2;
+        }
+        else
+        {
+            path = argv[i];
+        }
+    }
+
+    if (format == OutputFormat::kTsv &&
+        !WriteAll("input\tstatus\tcal_name\tmarketing_name\tgeneration\tapu\tnum_cus\tnum_shader_engines\tnum_simds\tnum_vgprs\twave_size\n"))
+    {
+        return 1;
+    }
+
+    if (nullptr == path)
+    {
+        InputReader reader;
+        return Resolve(reader, format, threadCount) ? 0 : 1;
+    }
+
+    const int   file     = open(path, O_RDONLY | O_CLOEXEC);
+    struct stat fileStat = {};
+    if (file < 0 || fstat(file, &fileStat) != 0)
+    {
+        std::fprintf(stderr, "device_info_resolve: cannot open %s: %s\n", path, std::strerror(errno));
+        return 1;
+    }
+
+    const size_t fileSize = static_cast<size_t>(fileStat.st_size);
+    void        *mapping  = (fileSize > 0) ? mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, file, 0) : nullptr;
+    close(file);
+    if (mapping == MAP_FAILED)
+    {
+        std::fprintf(stderr, "device_info_resolve: cannot map %s: %s\n", path, std::strerror(errno));
+        return 1;
+    }
+
+    if (nullptr != mapping)
+    {
+        madvise(mapping, fileSize, MADV_SEQUENTIAL);
+    }
+
+    InputReader reader(std::string_view(static_cast<const char *>(mapping), fileSize));
+    const bool  succeeded = Resolve(reader, format, threadCount);
+
+    if (nullptr != mapping)
+    {
+        munmap(mapping, fileSize);
+    }
+    return succeeded ? 0 : 1;
+}